@@ -41,6 +41,19 @@
     LBAL_PRAGMA(GCC warning LBAL_CPP_WARNING_message)                          \
     LBAL_DIAGNOSTIC_POP
 
+  //	Loop optimization pragmas
+  //
+  //	SEEME - bitweeder
+  //	clang has no `ivdep`; `vectorize(assume_safety)` is the equivalent,
+  //	telling the vectorizer to ignore memory dependences it can’t disprove.
+  #define LBAL_LOOP_UNROLL(LBAL_count_)                                        \
+    LBAL_PRAGMA(clang loop unroll_count(LBAL_count_))
+  #define LBAL_LOOP_NO_UNROLL LBAL_PRAGMA(clang loop unroll(disable))
+  #define LBAL_LOOP_VECTORIZE LBAL_PRAGMA(clang loop vectorize(enable))
+  #define LBAL_LOOP_IVDEP LBAL_PRAGMA(clang loop vectorize(assume_safety))
+  #define LBAL_LOOP_VECTORIZE_WIDTH(LBAL_width_)                               \
+    LBAL_PRAGMA(clang loop vectorize_width(LBAL_width_))
+
   //	Identify processor and characteristics.
   //	Note that AMD64 and x86_64 both trigger each other’s identifiers. We
   //	simply refer to all of them as LBAL_TARGET_CPU_X86_64.
@@ -109,6 +122,20 @@
     #define LBAL_TARGET_VEC_AVX2 1
   #endif
 
+  #ifdef __AVX512F__
+    #define LBAL_TARGET_VEC_AVX512F 1
+  #endif
+
+  //	Apple Silicon always has Advanced SIMD; SVE is not (yet) implemented by
+  //	any Apple core, but we test for it anyway for completeness.
+  #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define LBAL_TARGET_VEC_NEON 1
+  #endif
+
+  #ifdef __ARM_FEATURE_SVE
+    #define LBAL_TARGET_VEC_SVE 1
+  #endif
+
   //	Currently unused
   #ifdef __AVX512BW__
   #endif
@@ -119,9 +146,6 @@
   #ifdef __AVX512DQ__
   #endif
 
-  #ifdef __AVX512F__
-  #endif
-
   #ifdef __AVX5124FMAPS__
   #endif
 
@@ -244,6 +268,29 @@
   #define LBAL_HINT_likely(LBAL_expr_) __builtin_expect(LBAL_expr_, true)
   #define LBAL_HINT_unlikely(LBAL_expr_) __builtin_expect(LBAL_expr_, false)
 
+  #if __has_builtin(__builtin_expect_with_probability)
+    #define LBAL_HINT_expect_probability(                                      \
+        LBAL_expr_, LBAL_value_, LBAL_probability_)                            \
+      __builtin_expect_with_probability(                                       \
+          LBAL_expr_, LBAL_value_, LBAL_probability_)
+  #else
+    #define LBAL_HINT_expect_probability(                                      \
+        LBAL_expr_, LBAL_value_, LBAL_probability_)                            \
+      __builtin_expect(LBAL_expr_, LBAL_value_)
+  #endif
+
+  #if __has_builtin(__builtin_unpredictable)
+    #define LBAL_HINT_unpredictable(LBAL_expr_)                                \
+      __builtin_unpredictable(LBAL_expr_)
+  #endif
+
+  #define LBAL_IS_CONSTANT_P(LBAL_expr_) __builtin_constant_p(LBAL_expr_)
+
+  //	SEEME - bitweeder
+  //	This emits `PREFETCHh`/`PREFETCHW` on x86 and `PRFM` on ARM.
+  #define LBAL_HINT_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)             \
+    __builtin_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)
+
   //	Symbol visibility macros
   #define LBAL_VIS_HIDDEN __attribute__((__visibility__("hidden")))
 
@@ -320,6 +367,93 @@
   #define LBAL_FUNC_CALL_STD(LBAL_func_name_) LBAL_func_name_
   #define LBAL_FUNC_CALLBACK_C(LBAL_func_name_) (*LBAL_func_name_)
   #define LBAL_FUNC_CALLBACK_STD(LBAL_func_name_) (*LBAL_func_name_)
+
+  //	SEEME - bitweeder
+  //	Apple’s ABIs already pass vectors in registers. The `preserve_xxx`
+  //	conventions are only implemented for x86-64 and ARM64; elsewhere, Clang
+  //	ignores them with a warning.
+  #define LBAL_FUNC_CALL_VECTOR(LBAL_func_name_) LBAL_func_name_
+
+  #if __has_attribute(__regcall__)                                             \
+      && (LBAL_TARGET_CPU_X86 || LBAL_TARGET_CPU_X86_64)
+    #define LBAL_FUNC_CALL_REGCALL(LBAL_func_name_)                            \
+      __attribute__((__regcall__)) LBAL_func_name_
+  #else
+    #define LBAL_FUNC_CALL_REGCALL(LBAL_func_name_) LBAL_func_name_
+  #endif
+
+  #if LBAL_TARGET_CPU_X86_64 || LBAL_TARGET_CPU_ARM_64
+    #if __has_attribute(__preserve_most__)
+      #define LBAL_FUNC_PRESERVE_MOST __attribute__((__preserve_most__))
+    #endif
+
+    #if __has_attribute(__preserve_none__)
+      #define LBAL_FUNC_PRESERVE_NONE __attribute__((__preserve_none__))
+    #endif
+  #endif
+
+  //	Guaranteed tail calls
+  #if __has_cpp_attribute(clang::musttail)
+    #define LBAL_FEATURE_MUSTTAIL 1
+    #define LBAL_MUSTTAIL [[clang::musttail]]
+  #endif
+
+  //	Code generation model
+  #if defined(__PIC__) || defined(__PIE__)
+    #define LBAL_BUILD_PIC 1
+  #endif
+
+  #if defined(__PIE__)
+    #define LBAL_BUILD_PIE 1
+  #endif
+
+  //	Inlining control
+  #define LBAL_FUNC_FORCE_INLINE inline __attribute__((__always_inline__))
+  #define LBAL_FUNC_NOINLINE __attribute__((__noinline__))
+  #define LBAL_FUNC_FLATTEN __attribute__((__flatten__))
+  #define LBAL_LAMBDA_FORCE_INLINE __attribute__((__always_inline__))
+  #define LBAL_LAMBDA_NOINLINE __attribute__((__noinline__))
+
+  //	Code placement
+  #define LBAL_FUNC_HOT __attribute__((__hot__))
+  #define LBAL_FUNC_COLD __attribute__((__cold__))
+  #define LBAL_LAMBDA_COLD __attribute__((__cold__))
+  #define LBAL_SECTION(LBAL_section_name_)                                     \
+    __attribute__((__section__(LBAL_section_name_)))
+
+  //	SEEME - bitweeder
+  //	Mach-O has no conventional hot or cold text sections, so we make our
+  //	own; ld64 keeps each one contiguous within the `__TEXT` segment.
+  #define LBAL_FUNC_HOT_TEXT                                                   \
+    __attribute__((__section__("__TEXT,__text_hot,regular,pure_instructions")))
+  #define LBAL_FUNC_COLD_TEXT                                                  \
+    __attribute__((__section__("__TEXT,__text_cold,regular,pure_instructions")))
+
+  //	Aliasing and allocation
+  #define LBAL_RESTRICT __restrict__
+  #define LBAL_FUNC_MALLOC __attribute__((__malloc__))
+  #define LBAL_FUNC_ALLOC_SIZE(...) __attribute__((__alloc_size__(__VA_ARGS__)))
+
+  #if __has_attribute(__alloc_align__)
+    #define LBAL_FUNC_ALLOC_ALIGN(LBAL_param_index_)                           \
+      __attribute__((__alloc_align__(LBAL_param_index_)))
+  #endif
+
+  //	Side effects and pointer validity
+  #define LBAL_FUNC_PURE __attribute__((__pure__))
+  #define LBAL_FUNC_CONST __attribute__((__const__))
+  #define LBAL_FUNC_NONNULL(...) __attribute__((__nonnull__(__VA_ARGS__)))
+  #define LBAL_FUNC_RETURNS_NONNULL __attribute__((__returns_nonnull__))
+
+  #if __has_attribute(__assume_aligned__)
+    #define LBAL_FUNC_ASSUME_ALIGNED_RETURN(LBAL_alignment_)                   \
+      __attribute__((__assume_aligned__(LBAL_alignment_)))
+  #endif
+
+  //	Layout and ABI
+  #if __has_cpp_attribute(clang::trivial_abi)
+    #define LBAL_CLASS_TRIVIAL_ABI [[clang::trivial_abi]]
+  #endif
 #else
   #error                                                                       \
       "lbalAppleClangInitialization.hpp was directly included while using the wrong compiler"
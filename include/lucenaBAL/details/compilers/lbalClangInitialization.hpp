@@ -41,6 +41,19 @@
     LBAL_PRAGMA(GCC warning LBAL_CPP_WARNING_message)                          \
     LBAL_DIAGNOSTIC_POP
 
+  //	Loop optimization pragmas
+  //
+  //	SEEME - bitweeder
+  //	clang has no `ivdep`; `vectorize(assume_safety)` is the equivalent,
+  //	telling the vectorizer to ignore memory dependences it can’t disprove.
+  #define LBAL_LOOP_UNROLL(LBAL_count_)                                        \
+    LBAL_PRAGMA(clang loop unroll_count(LBAL_count_))
+  #define LBAL_LOOP_NO_UNROLL LBAL_PRAGMA(clang loop unroll(disable))
+  #define LBAL_LOOP_VECTORIZE LBAL_PRAGMA(clang loop vectorize(enable))
+  #define LBAL_LOOP_IVDEP LBAL_PRAGMA(clang loop vectorize(assume_safety))
+  #define LBAL_LOOP_VECTORIZE_WIDTH(LBAL_width_)                               \
+    LBAL_PRAGMA(clang loop vectorize_width(LBAL_width_))
+
   //	Identify processor and characteristics.
   //	Note that AMD64 and x86_64 both trigger each other’s identifiers. We
   //	simply refer to all of them as LBAL_TARGET_CPU_X86_64.
@@ -109,6 +122,18 @@
     #define LBAL_TARGET_VEC_AVX2 1
   #endif
 
+  #ifdef __AVX512F__
+    #define LBAL_TARGET_VEC_AVX512F 1
+  #endif
+
+  #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define LBAL_TARGET_VEC_NEON 1
+  #endif
+
+  #ifdef __ARM_FEATURE_SVE
+    #define LBAL_TARGET_VEC_SVE 1
+  #endif
+
   //	Identify executable file fromat
   #if defined(__ELF__)
     #define LBAL_TARGET_RT_ELF 1
@@ -196,9 +221,38 @@
   #define LBAL_HINT_likely(LBAL_expr_) __builtin_expect(LBAL_expr_, true)
   #define LBAL_HINT_unlikely(LBAL_expr_) __builtin_expect(LBAL_expr_, false)
 
+  #if __has_builtin(__builtin_expect_with_probability)
+    #define LBAL_HINT_expect_probability(                                      \
+        LBAL_expr_, LBAL_value_, LBAL_probability_)                            \
+      __builtin_expect_with_probability(                                       \
+          LBAL_expr_, LBAL_value_, LBAL_probability_)
+  #else
+    #define LBAL_HINT_expect_probability(                                      \
+        LBAL_expr_, LBAL_value_, LBAL_probability_)                            \
+      __builtin_expect(LBAL_expr_, LBAL_value_)
+  #endif
+
+  #if __has_builtin(__builtin_unpredictable)
+    #define LBAL_HINT_unpredictable(LBAL_expr_)                                \
+      __builtin_unpredictable(LBAL_expr_)
+  #endif
+
+  #define LBAL_IS_CONSTANT_P(LBAL_expr_) __builtin_constant_p(LBAL_expr_)
+
+  //	SEEME - bitweeder
+  //	This emits `PREFETCHh`/`PREFETCHW` on x86 and `PRFM` on ARM.
+  #define LBAL_HINT_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)             \
+    __builtin_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)
+
   //	Symbol visibility macros
   #define LBAL_VIS_HIDDEN __attribute__((__visibility__("hidden")))
 
+  //	SEEME - bitweeder
+  //	Protected visibility only exists for ELF.
+  #if defined(__ELF__)
+    #define LBAL_VIS_PROTECTED __attribute__((__visibility__("protected")))
+  #endif
+
   #define LBAL_VIS_CLASS_EXPORT __attribute__((__visibility__("default")))
   #define LBAL_VIS_CLASS_IMPORT __attribute__((__visibility__("default")))
 
@@ -272,6 +326,126 @@
   #define LBAL_FUNC_CALL_STD(LBAL_func_name_) LBAL_func_name_
   #define LBAL_FUNC_CALLBACK_C(LBAL_func_name_) (*LBAL_func_name_)
   #define LBAL_FUNC_CALLBACK_STD(LBAL_func_name_) (*LBAL_func_name_)
+
+  //	SEEME - bitweeder
+  //	Outside of Windows, the SysV ABI already passes vectors in registers.
+  //	The `preserve_xxx` conventions are only implemented for x86-64 and
+  //	ARM64; elsewhere, Clang ignores them with a warning.
+  #if defined(_WIN32) && __has_attribute(__vectorcall__)                       \
+      && (LBAL_TARGET_CPU_X86 || LBAL_TARGET_CPU_X86_64)
+    #define LBAL_FUNC_CALL_VECTOR(LBAL_func_name_)                             \
+      __attribute__((__vectorcall__)) LBAL_func_name_
+  #else
+    #define LBAL_FUNC_CALL_VECTOR(LBAL_func_name_) LBAL_func_name_
+  #endif
+
+  #if __has_attribute(__regcall__)                                             \
+      && (LBAL_TARGET_CPU_X86 || LBAL_TARGET_CPU_X86_64)
+    #define LBAL_FUNC_CALL_REGCALL(LBAL_func_name_)                            \
+      __attribute__((__regcall__)) LBAL_func_name_
+  #else
+    #define LBAL_FUNC_CALL_REGCALL(LBAL_func_name_) LBAL_func_name_
+  #endif
+
+  #if LBAL_TARGET_CPU_X86_64 || LBAL_TARGET_CPU_ARM_64
+    #if __has_attribute(__preserve_most__)
+      #define LBAL_FUNC_PRESERVE_MOST __attribute__((__preserve_most__))
+    #endif
+
+    #if __has_attribute(__preserve_none__)
+      #define LBAL_FUNC_PRESERVE_NONE __attribute__((__preserve_none__))
+    #endif
+  #endif
+
+  //	Guaranteed tail calls
+  #if __has_cpp_attribute(clang::musttail)
+    #define LBAL_FEATURE_MUSTTAIL 1
+    #define LBAL_MUSTTAIL [[clang::musttail]]
+  #endif
+
+  //	Code generation model
+  #if defined(__PIC__) || defined(__PIE__)
+    #define LBAL_BUILD_PIC 1
+  #endif
+
+  #if defined(__PIE__)
+    #define LBAL_BUILD_PIE 1
+  #endif
+
+  //	Thread-local storage models
+  //
+  //	SEEME - bitweeder
+  //	These only exist for ELF. Local-exec is only valid in the executable
+  //	itself, so shared libraries get the next-best model instead.
+  #if defined(__ELF__)
+    #define LBAL_TLS_LOCAL_DYNAMIC                                             \
+      __attribute__((__tls_model__("local-dynamic")))
+    #define LBAL_TLS_INITIAL_EXEC __attribute__((__tls_model__("initial-exec")))
+
+    #if LBAL_BUILD_PIE || !LBAL_BUILD_PIC
+      #define LBAL_TLS_LOCAL_EXEC __attribute__((__tls_model__("local-exec")))
+    #else
+      #define LBAL_TLS_LOCAL_EXEC LBAL_TLS_INITIAL_EXEC
+    #endif
+  #endif
+
+  //	Inlining control
+  #define LBAL_FUNC_FORCE_INLINE inline __attribute__((__always_inline__))
+  #define LBAL_FUNC_NOINLINE __attribute__((__noinline__))
+  #define LBAL_FUNC_FLATTEN __attribute__((__flatten__))
+  #define LBAL_LAMBDA_FORCE_INLINE __attribute__((__always_inline__))
+  #define LBAL_LAMBDA_NOINLINE __attribute__((__noinline__))
+
+  //	Code placement
+  #define LBAL_FUNC_HOT __attribute__((__hot__))
+  #define LBAL_FUNC_COLD __attribute__((__cold__))
+  #define LBAL_LAMBDA_COLD __attribute__((__cold__))
+  #define LBAL_SECTION(LBAL_section_name_)                                     \
+    __attribute__((__section__(LBAL_section_name_)))
+
+  //	SEEME - bitweeder
+  //	GNU ld’s default script gathers `.text.unlikely`, then `.text.hot`,
+  //	ahead of the rest of `.text`. LLD and mold merge them into `.text` in
+  //	input order unless linked with `-z keep-text-section-prefix`; see
+  //	`lbal_target_keep_text_prefixes`.
+  #if defined(__ELF__)
+    #define LBAL_FUNC_HOT_TEXT __attribute__((__section__(".text.hot")))
+    #define LBAL_FUNC_COLD_TEXT __attribute__((__section__(".text.unlikely")))
+  #endif
+
+  //	Aliasing and allocation
+  #define LBAL_RESTRICT __restrict__
+  #define LBAL_FUNC_MALLOC __attribute__((__malloc__))
+  #define LBAL_FUNC_ALLOC_SIZE(...) __attribute__((__alloc_size__(__VA_ARGS__)))
+
+  #if __has_attribute(__alloc_align__)
+    #define LBAL_FUNC_ALLOC_ALIGN(LBAL_param_index_)                           \
+      __attribute__((__alloc_align__(LBAL_param_index_)))
+  #endif
+
+  //	Side effects and pointer validity
+  #define LBAL_FUNC_PURE __attribute__((__pure__))
+  #define LBAL_FUNC_CONST __attribute__((__const__))
+  #define LBAL_FUNC_NONNULL(...) __attribute__((__nonnull__(__VA_ARGS__)))
+  #define LBAL_FUNC_RETURNS_NONNULL __attribute__((__returns_nonnull__))
+
+  #if __has_attribute(__assume_aligned__)
+    #define LBAL_FUNC_ASSUME_ALIGNED_RETURN(LBAL_alignment_)                   \
+      __attribute__((__assume_aligned__(LBAL_alignment_)))
+  #endif
+
+  //	Layout and ABI
+  //
+  //	SEEME - bitweeder
+  //	When targeting the MSVC ABI, Clang follows MSVC in ignoring the Standard
+  //	spelling of `no_unique_address`.
+  #if defined(_MSC_VER) && __has_cpp_attribute(msvc::no_unique_address)
+    #define LBAL_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+  #endif
+
+  #if __has_cpp_attribute(clang::trivial_abi)
+    #define LBAL_CLASS_TRIVIAL_ABI [[clang::trivial_abi]]
+  #endif
 #else
   #error                                                                       \
       "lbalClangInitialization.hpp was directly included while using the wrong compiler"
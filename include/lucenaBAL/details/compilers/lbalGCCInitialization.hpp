@@ -46,6 +46,19 @@
   #define LBAL_CPP_WARNING(LBAL_CPP_WARNING_message)                           \
     LBAL_PRAGMA(GCC warning LBAL_CPP_WARNING_message)
 
+  //	Loop optimization pragmas
+  //
+  //	SEEME - bitweeder
+  //	GCC has no pragma to request vectorization or a vector width short of
+  //	`omp simd`, which is ignored—with a warning—without `-fopenmp-simd`;
+  //	those are left empty, and `ivdep` is the closest thing available.
+  #if (LBAL_GCC_VERSION >= 80000)
+    #define LBAL_LOOP_UNROLL(LBAL_count_) LBAL_PRAGMA(GCC unroll LBAL_count_)
+    #define LBAL_LOOP_NO_UNROLL LBAL_PRAGMA(GCC unroll 1)
+  #endif
+
+  #define LBAL_LOOP_IVDEP LBAL_PRAGMA(GCC ivdep)
+
   //	Identify processor.
   //	Note that AMD64 and x86_64 both trigger each other’s identifiers. We
   //	simply refer to all of them as LBAL_TARGET_CPU_X86_64.
@@ -109,6 +122,18 @@
     #define LBAL_TARGET_VEC_AVX2 1
   #endif
 
+  #ifdef __AVX512F__
+    #define LBAL_TARGET_VEC_AVX512F 1
+  #endif
+
+  #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define LBAL_TARGET_VEC_NEON 1
+  #endif
+
+  #ifdef __ARM_FEATURE_SVE
+    #define LBAL_TARGET_VEC_SVE 1
+  #endif
+
   //	Identify executable file fromat
   //	SEEME - bitweeder
   //	Architecture is the same across Linux derivatives (ignoring old a.out),
@@ -194,9 +219,41 @@
   #define LBAL_HINT_likely(LBAL_expr_) __builtin_expect(LBAL_expr_, true)
   #define LBAL_HINT_unlikely(LBAL_expr_) __builtin_expect(LBAL_expr_, false)
 
+  #if (LBAL_GCC_VERSION >= 90000)
+    #define LBAL_HINT_expect_probability(                                      \
+        LBAL_expr_, LBAL_value_, LBAL_probability_)                            \
+      __builtin_expect_with_probability(                                       \
+          LBAL_expr_, LBAL_value_, LBAL_probability_)
+  #else
+    #define LBAL_HINT_expect_probability(                                      \
+        LBAL_expr_, LBAL_value_, LBAL_probability_)                            \
+      __builtin_expect(LBAL_expr_, LBAL_value_)
+  #endif
+
+  //	SEEME - bitweeder
+  //	GCC has no direct equivalent of `__builtin_unpredictable`; an even
+  //	probability is the closest thing, and steers if-conversion the same way.
+  #if (LBAL_GCC_VERSION >= 90000)
+    #define LBAL_HINT_unpredictable(LBAL_expr_)                                \
+      __builtin_expect_with_probability(LBAL_expr_, true, 0.5)
+  #endif
+
+  #define LBAL_IS_CONSTANT_P(LBAL_expr_) __builtin_constant_p(LBAL_expr_)
+
+  //	SEEME - bitweeder
+  //	This emits `PREFETCHh`/`PREFETCHW` on x86 and `PRFM` on ARM.
+  #define LBAL_HINT_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)             \
+    __builtin_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)
+
   //	Symbol visibility macros
   #define LBAL_VIS_HIDDEN __attribute__((__visibility__("hidden")))
 
+  //	SEEME - bitweeder
+  //	Protected visibility only exists for ELF.
+  #if defined(__ELF__)
+    #define LBAL_VIS_PROTECTED __attribute__((__visibility__("protected")))
+  #endif
+
   #define LBAL_VIS_CLASS_EXPORT __attribute__((__visibility__("default")))
   #define LBAL_VIS_CLASS_IMPORT __attribute__((__visibility__("default")))
 
@@ -272,6 +329,99 @@
   #define LBAL_FUNC_CALLBACK_C(LBAL_func_name_) (*LBAL_func_name_)
   #define LBAL_FUNC_CALLBACK_STD(LBAL_func_name_) (*LBAL_func_name_)
 
+  //	SEEME - bitweeder
+  //	The SysV ABI already passes vectors in registers. GCC has no `regcall`
+  //	or `preserve_most`, and only supports `preserve_none` on x86-64.
+  #define LBAL_FUNC_CALL_VECTOR(LBAL_func_name_) LBAL_func_name_
+  #define LBAL_FUNC_CALL_REGCALL(LBAL_func_name_) LBAL_func_name_
+
+  #if LBAL_TARGET_CPU_X86_64 && __has_attribute(__preserve_none__)
+    #define LBAL_FUNC_PRESERVE_NONE __attribute__((__preserve_none__))
+  #endif
+
+  //	Guaranteed tail calls
+  #if __has_attribute(__musttail__)
+    #define LBAL_FEATURE_MUSTTAIL 1
+    #define LBAL_MUSTTAIL __attribute__((__musttail__))
+  #endif
+
+  //	SEEME - bitweeder
+  //	This is only implemented for x86 targets.
+  #if __has_attribute(__noplt__)
+    #define LBAL_FUNC_NOPLT __attribute__((__noplt__))
+  #endif
+
+  //	Code generation model
+  #if defined(__PIC__) || defined(__PIE__)
+    #define LBAL_BUILD_PIC 1
+  #endif
+
+  #if defined(__PIE__)
+    #define LBAL_BUILD_PIE 1
+  #endif
+
+  //	Thread-local storage models
+  //
+  //	SEEME - bitweeder
+  //	These only exist for ELF. Local-exec is only valid in the executable
+  //	itself, so shared libraries get the next-best model instead.
+  #if defined(__ELF__)
+    #define LBAL_TLS_LOCAL_DYNAMIC                                             \
+      __attribute__((__tls_model__("local-dynamic")))
+    #define LBAL_TLS_INITIAL_EXEC __attribute__((__tls_model__("initial-exec")))
+
+    #if LBAL_BUILD_PIE || !LBAL_BUILD_PIC
+      #define LBAL_TLS_LOCAL_EXEC __attribute__((__tls_model__("local-exec")))
+    #else
+      #define LBAL_TLS_LOCAL_EXEC LBAL_TLS_INITIAL_EXEC
+    #endif
+  #endif
+
+  //	Inlining control
+  #define LBAL_FUNC_FORCE_INLINE inline __attribute__((__always_inline__))
+  #define LBAL_FUNC_NOINLINE __attribute__((__noinline__))
+  #define LBAL_FUNC_FLATTEN __attribute__((__flatten__))
+  #define LBAL_LAMBDA_FORCE_INLINE __attribute__((__always_inline__))
+  #define LBAL_LAMBDA_NOINLINE __attribute__((__noinline__))
+
+  //	Code placement
+  #define LBAL_FUNC_HOT __attribute__((__hot__))
+  #define LBAL_FUNC_COLD __attribute__((__cold__))
+  #define LBAL_LAMBDA_COLD __attribute__((__cold__))
+  #define LBAL_SECTION(LBAL_section_name_)                                     \
+    __attribute__((__section__(LBAL_section_name_)))
+
+  //	SEEME - bitweeder
+  //	GNU ld’s default script gathers `.text.unlikely`, then `.text.hot`,
+  //	ahead of the rest of `.text`. LLD and mold merge them into `.text` in
+  //	input order unless linked with `-z keep-text-section-prefix`; see
+  //	`lbal_target_keep_text_prefixes`.
+  #if defined(__ELF__)
+    #define LBAL_FUNC_HOT_TEXT __attribute__((__section__(".text.hot")))
+    #define LBAL_FUNC_COLD_TEXT __attribute__((__section__(".text.unlikely")))
+  #endif
+
+  //	Aliasing and allocation
+  #define LBAL_RESTRICT __restrict__
+  #define LBAL_FUNC_MALLOC __attribute__((__malloc__))
+  #define LBAL_FUNC_ALLOC_SIZE(...) __attribute__((__alloc_size__(__VA_ARGS__)))
+
+  #if __has_attribute(__alloc_align__)
+    #define LBAL_FUNC_ALLOC_ALIGN(LBAL_param_index_)                           \
+      __attribute__((__alloc_align__(LBAL_param_index_)))
+  #endif
+
+  //	Side effects and pointer validity
+  #define LBAL_FUNC_PURE __attribute__((__pure__))
+  #define LBAL_FUNC_CONST __attribute__((__const__))
+  #define LBAL_FUNC_NONNULL(...) __attribute__((__nonnull__(__VA_ARGS__)))
+  #define LBAL_FUNC_RETURNS_NONNULL __attribute__((__returns_nonnull__))
+
+  #if __has_attribute(__assume_aligned__)
+    #define LBAL_FUNC_ASSUME_ALIGNED_RETURN(LBAL_alignment_)                   \
+      __attribute__((__assume_aligned__(LBAL_alignment_)))
+  #endif
+
   //	We get rid of this since it isn’t an officially supported feature.
   #undef LBAL_GCC_VERSION
 #else
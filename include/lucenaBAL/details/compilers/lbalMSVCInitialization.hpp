@@ -38,6 +38,13 @@
   #define LBAL_CPP_WARNING(LBAL_CPP_WARNING_message)                           \
     LBAL_PRAGMA(message("warning: " LBAL_CPP_WARNING_message))
 
+  //	Loop optimization pragmas
+  //
+  //	SEEME - bitweeder
+  //	MSVC can only be told to ignore dependences, or to not vectorize; it
+  //	offers no control over unrolling.
+  #define LBAL_LOOP_IVDEP LBAL_PRAGMA(loop(ivdep))
+
   //	Identify processor.
   //	Note that AMD64 and x86_64 have the same identifier.
   #if defined(_M_IX86)
@@ -95,11 +102,13 @@
       #define LBAL_TARGET_VEC_AVX2 1
     #endif
 
-  //	SEEME - bitweeder
-  //	There appear to be no intrinsics for detecting AVX-512 support in MSVC,
-  //	yet, though support may be undocumented or under-reported. It’s
-  //	currently moot, though, as we don’t support this instruction set family
-  //	at this time.
+    //	SEEME - bitweeder
+    //	MSVC defines `__AVX512F__` (and friends) when building with
+    //	`/arch:AVX512`; we only track the foundation subset, which is all that’s
+    //	needed to establish the native vector width.
+    #ifdef __AVX512F__
+      #define LBAL_TARGET_VEC_AVX512F 1
+    #endif
   #endif
 
   //	SEEME - bitweeder
@@ -184,6 +193,21 @@
     #define LBAL_CPP14_SIZED_DEALLOCATION 0
   #endif
 
+  //	intrinsic functions
+  //
+  //	SEEME - bitweeder
+  //	`<intrin.h>` is a compiler header, not a Standard Library one, so this
+  //	doesn’t compromise the metaheader’s promise to only include `<version>`.
+  //	The `_MM_HINT_xxx` levels run in the opposite direction from
+  //	`__builtin_prefetch` locality, with `_MM_HINT_NTA` being `0`; writes use
+  //	`PREFETCHW`, which pre-Broadwell Intel parts execute as a no-op.
+  #include <intrin.h>
+
+  #define LBAL_HINT_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)             \
+    ((LBAL_rw_) ? _m_prefetchw(LBAL_addr_)                                     \
+                : _mm_prefetch(reinterpret_cast<char const *>(LBAL_addr_),     \
+                      (LBAL_locality_) ? (4 - (LBAL_locality_)) : 0))
+
   //	Symbol visibility macros
   #define LBAL_VIS_HIDDEN
 
@@ -227,11 +251,68 @@
   //	Class decorators
   #define LBAL_CLASS_FORCE_EBCO __declspec(empty_bases)
 
+  //	SEEME - bitweeder
+  //	MSVC accepts, but ignores, the Standard spelling of `no_unique_address`
+  //	to preserve ABI compatibility, so we never fall back to it here.
+  #if __has_cpp_attribute(msvc::no_unique_address)
+    #define LBAL_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+  #else
+    #define LBAL_NO_UNIQUE_ADDRESS
+  #endif
+
   //	Function calling conventions
   #define LBAL_FUNC_CALL_C(LBAL_func_name_) __cdecl LBAL_func_name_
   #define LBAL_FUNC_CALL_STD(LBAL_func_name_) __stdcall LBAL_func_name_
   #define LBAL_FUNC_CALLBACK_C(LBAL_func_name_) (__cdecl * LBAL_func_name_)
   #define LBAL_FUNC_CALLBACK_STD(LBAL_func_name_) (__stdcall * LBAL_func_name_)
+
+  //	SEEME - bitweeder
+  //	`__vectorcall` is x86 and x64 only; MSVC has no `__regcall`, leaving that
+  //	to the Intel and Clang front ends.
+  #if LBAL_TARGET_CPU_X86 || LBAL_TARGET_CPU_X86_64
+    #define LBAL_FUNC_CALL_VECTOR(LBAL_func_name_) __vectorcall LBAL_func_name_
+  #else
+    #define LBAL_FUNC_CALL_VECTOR(LBAL_func_name_) LBAL_func_name_
+  #endif
+
+  #define LBAL_FUNC_CALL_REGCALL(LBAL_func_name_) LBAL_func_name_
+
+  //	Inlining control
+  //
+  //	SEEME - bitweeder
+  //	The `msvc::` attributes arrived piecemeal during the VS 2019 and 2022
+  //	cycles, so we test for each rather than keying off `_MSC_VER`.
+  #define LBAL_FUNC_FORCE_INLINE __forceinline
+  #define LBAL_FUNC_NOINLINE __declspec(noinline)
+
+  #if __has_cpp_attribute(msvc::flatten)
+    #define LBAL_FUNC_FLATTEN [[msvc::flatten]]
+  #endif
+
+  #if __has_cpp_attribute(msvc::forceinline)
+    #define LBAL_LAMBDA_FORCE_INLINE [[msvc::forceinline]]
+  #endif
+
+  #if __has_cpp_attribute(msvc::noinline)
+    #define LBAL_LAMBDA_NOINLINE [[msvc::noinline]]
+  #endif
+
+  //	Code placement
+  //
+  //	SEEME - bitweeder
+  //	MSVC has no hot/cold attributes or general-purpose section attribute;
+  //	profile-guided optimization and link-time ordering, e.g., via
+  //	`lbal_target_symbol_ordering`, are the only ways to influence function
+  //	placement.
+
+  //	Aliasing and allocation
+  //
+  //	SEEME - bitweeder
+  //	`__declspec(restrict)` is the MSVC analog of `__malloc__`, and should
+  //	not be confused with `__restrict`. There are no equivalents to the size
+  //	and alignment attributes.
+  #define LBAL_RESTRICT __restrict
+  #define LBAL_FUNC_MALLOC __declspec(restrict)
 #else
   #error                                                                       \
       "lbalMSVCInitialization.hpp was directly included while using the wrong compiler"
@@ -0,0 +1,121 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalCPUID.hpp”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+  Internal support for the runtime queries in `lbalPlatformInfo.hpp`; this
+  is not part of the public interface.
+
+------------------------------------------------------------------------------*/
+
+#pragma once
+
+//	lbal
+#include <lucenaBAL/lucenaBAL.hpp>
+
+//	std
+#include <cstdint>
+
+#if LBAL_TARGET_CPU_X86 || LBAL_TARGET_CPU_X86_64
+  #if LBAL_TARGET_COMPILER_MSVC
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+#endif
+
+/*------------------------------------------------------------------------------
+  CPUID
+
+  A thin wrapper over the `cpuid` instruction that reports failure, rather
+  than returning garbage, when the requested leaf is out of range or the
+  target isn’t x86.
+*/
+
+LBAL_begin_v_namespace
+
+namespace details {
+
+struct cpuid_registers {
+  std::uint32_t eax{0};
+  std::uint32_t ebx{0};
+  std::uint32_t ecx{0};
+  std::uint32_t edx{0};
+};
+
+inline bool
+cpuid(
+    std::uint32_t in_leaf,
+    std::uint32_t in_subleaf,
+    cpuid_registers & o_registers
+) noexcept {
+#if (LBAL_TARGET_CPU_X86 || LBAL_TARGET_CPU_X86_64)                            \
+    && LBAL_TARGET_COMPILER_MSVC
+  int registers[4]{};
+
+  //	The high bit selects between the basic and extended leaf ranges, each of
+  //	which reports its own maximum.
+  __cpuid(registers, static_cast<int>(in_leaf & 0x80000000u));
+
+  if (static_cast<std::uint32_t>(registers[0]) < in_leaf) return false;
+
+  __cpuidex(
+      registers, static_cast<int>(in_leaf), static_cast<int>(in_subleaf));
+
+  o_registers.eax = static_cast<std::uint32_t>(registers[0]);
+  o_registers.ebx = static_cast<std::uint32_t>(registers[1]);
+  o_registers.ecx = static_cast<std::uint32_t>(registers[2]);
+  o_registers.edx = static_cast<std::uint32_t>(registers[3]);
+
+  return true;
+#elif LBAL_TARGET_CPU_X86 || LBAL_TARGET_CPU_X86_64
+  unsigned int eax{0};
+  unsigned int ebx{0};
+  unsigned int ecx{0};
+  unsigned int edx{0};
+
+  if (__get_cpuid_max(in_leaf & 0x80000000u, nullptr) < in_leaf) return false;
+
+  __cpuid_count(in_leaf, in_subleaf, eax, ebx, ecx, edx);
+
+  o_registers.eax = eax;
+  o_registers.ebx = ebx;
+  o_registers.ecx = ecx;
+  o_registers.edx = edx;
+
+  return true;
+#else
+  static_cast<void>(in_leaf);
+  static_cast<void>(in_subleaf);
+  static_cast<void>(o_registers);
+
+  return false;
+#endif
+}
+
+//	Whether this is a hybrid part, i.e., one mixing core types, per leaf 7.
+inline bool
+cpuid_is_hybrid() noexcept {
+  cpuid_registers registers;
+
+  return cpuid(7, 0, registers) && (registers.edx & (1u << 15));
+}
+
+//	The core type of whichever CPU this thread is currently running on, per
+//	leaf 0x1A: `0x40` for a performance (Core) core, `0x20` for an efficiency
+//	(Atom) core, or `0` if unknown.
+inline std::uint32_t
+cpuid_core_type() noexcept {
+  cpuid_registers registers;
+
+  return cpuid(0x1Au, 0, registers) ? (registers.eax >> 24) : 0;
+}
+
+}  //	namespace details
+
+LBAL_end_v_namespace
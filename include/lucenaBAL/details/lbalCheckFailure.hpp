@@ -0,0 +1,45 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalCheckFailure.hpp”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+  Support for the checked forms of the `LBAL_HINT` macros; this is only
+  included when one of them is enabled, and is not part of the public
+  interface.
+
+------------------------------------------------------------------------------*/
+
+#pragma once
+
+//	lbal
+#include <lucenaBAL/lbalConfig.hpp>
+
+//	std
+#include <cstdio>
+#include <cstdlib>
+
+LBAL_begin_v_namespace
+
+namespace details {
+
+//	Report a failed check to `stderr` and abort.
+[[noreturn]] inline void
+check_failed(
+    char const * in_what,
+    char const * in_expr,
+    char const * in_file,
+    int in_line
+) noexcept {
+  std::fprintf(stderr, "%s:%d: %s: %s\n", in_file, in_line, in_what, in_expr);
+  std::fflush(stderr);
+  std::abort();
+}
+
+}  //	namespace details
+
+LBAL_end_v_namespace
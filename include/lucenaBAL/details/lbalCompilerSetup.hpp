@@ -832,3 +832,247 @@
 #elif LBAL_TARGET_CPU_X86
   #define LBAL_NAME_TARGET_CPU u8"i386"
 #endif
+
+/*------------------------------------------------------------------------------
+  Set up the native vector width and register file.
+
+  SEEME - bitweeder
+  These are derived strictly from the `LBAL_TARGET_VEC_xxx` tokens, so they
+  describe what the compiler has been told it may emit, not what the machine
+  running the code happens to support. Order matters: wider instruction sets
+  imply the narrower ones on the same family.
+*/
+
+#if LBAL_TARGET_VEC_AVX512F
+  #define LBAL_TARGET_VEC_NATIVE_BYTES 64
+
+  #if LBAL_TARGET_CPU_X86_64
+    #define LBAL_TARGET_VEC_REGISTER_COUNT 32
+  #else
+    #define LBAL_TARGET_VEC_REGISTER_COUNT 8
+  #endif
+#elif LBAL_TARGET_VEC_AVX || LBAL_TARGET_VEC_AVX2
+  #define LBAL_TARGET_VEC_NATIVE_BYTES 32
+
+  #if LBAL_TARGET_CPU_X86_64
+    #define LBAL_TARGET_VEC_REGISTER_COUNT 16
+  #else
+    #define LBAL_TARGET_VEC_REGISTER_COUNT 8
+  #endif
+#elif LBAL_TARGET_VEC_SVE
+  //	SVE is vector-length agnostic; unless the vector length has been fixed
+  //	at compile time (`-msve-vector-bits`), all we can promise is the
+  //	architectural minimum of 128 bits.
+  #if defined(__ARM_FEATURE_SVE_BITS) && (__ARM_FEATURE_SVE_BITS > 0)
+    #define LBAL_TARGET_VEC_NATIVE_BYTES (__ARM_FEATURE_SVE_BITS / 8)
+  #else
+    #define LBAL_TARGET_VEC_NATIVE_BYTES 16
+  #endif
+
+  #define LBAL_TARGET_VEC_REGISTER_COUNT 32
+#elif LBAL_TARGET_VEC_NEON
+  #define LBAL_TARGET_VEC_NATIVE_BYTES 16
+
+  #if LBAL_TARGET_CPU_ARM_64
+    #define LBAL_TARGET_VEC_REGISTER_COUNT 32
+  #else
+    #define LBAL_TARGET_VEC_REGISTER_COUNT 16
+  #endif
+#elif LBAL_TARGET_VEC_SSE
+  #define LBAL_TARGET_VEC_NATIVE_BYTES 16
+
+  #if LBAL_TARGET_CPU_X86_64
+    #define LBAL_TARGET_VEC_REGISTER_COUNT 16
+  #else
+    #define LBAL_TARGET_VEC_REGISTER_COUNT 8
+  #endif
+#endif
+
+/*------------------------------------------------------------------------------
+  Set up checked hints.
+*/
+
+#if LBAL_CONFIG_check_assumptions                                              \
+    || (defined(LBAL_CONFIG_debug) && LBAL_CONFIG_debug)
+  #include <lucenaBAL/details/lbalCheckFailure.hpp>
+#endif
+
+/*------------------------------------------------------------------------------
+  Set up assumptions.
+
+  SEEME - bitweeder
+  These depend on the SD-6 attribute tests, so they can’t live in the
+  compiler-specific headers. Only the checked form and the GCC fallback
+  evaluate the expression; the others merely inspect it.
+*/
+
+#if LBAL_CONFIG_check_assumptions
+
+  #define LBAL_HINT_assume(LBAL_expr_)                                         \
+    do {                                                                       \
+      if (!(LBAL_expr_)) {                                                     \
+        LBAL_::details::check_failed(                                          \
+            "assumption violated", #LBAL_expr_, __FILE__, __LINE__);           \
+      }                                                                        \
+    } while (false)
+#elif LBAL_CPP23_ATTRIBUTE_ASSUME
+  #define LBAL_HINT_assume(LBAL_expr_) [[assume(LBAL_expr_)]]
+#elif LBAL_TARGET_COMPILER_CLANG
+  #define LBAL_HINT_assume(LBAL_expr_) __builtin_assume(LBAL_expr_)
+#elif LBAL_TARGET_COMPILER_MSVC
+  #define LBAL_HINT_assume(LBAL_expr_) __assume(LBAL_expr_)
+#elif LBAL_TARGET_COMPILER_GCC
+  #define LBAL_HINT_assume(LBAL_expr_)                                         \
+    do {                                                                       \
+      if (!(LBAL_expr_)) __builtin_unreachable();                              \
+    } while (false)
+#endif
+
+/*------------------------------------------------------------------------------
+  Set up unreachable code markers.
+
+  SEEME - bitweeder
+  `std::unreachable` is only used as a last resort, from
+  `lbalLibrarySetup.hpp`, since it requires `<utility>`; everywhere we know
+  of, it’s implemented in terms of these builtins anyway.
+*/
+
+#if defined(LBAL_CONFIG_debug) && LBAL_CONFIG_debug
+  #define LBAL_HINT_unreachable()                                              \
+    LBAL_::details::check_failed("unreachable code reached",                   \
+        "LBAL_HINT_unreachable()", __FILE__, __LINE__)
+#elif LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC
+  #define LBAL_HINT_unreachable() __builtin_unreachable()
+#elif LBAL_TARGET_COMPILER_MSVC
+  #define LBAL_HINT_unreachable() __assume(0)
+#endif
+
+/*------------------------------------------------------------------------------
+  Set up range prefetching.
+
+  SEEME - bitweeder
+  The final byte is prefetched separately, since a range that doesn’t start
+  on a line boundary can spill onto one more line than the stride covers.
+*/
+
+#if defined(LBAL_HINT_prefetch)
+  #define LBAL_HINT_prefetch_range(LBAL_ptr_, LBAL_bytes_)                     \
+    do {                                                                       \
+      auto const LBAL_prefetch_base_ =                                         \
+          reinterpret_cast<char const *>(LBAL_ptr_);                           \
+      auto const LBAL_prefetch_bytes_ =                                        \
+          static_cast<decltype(sizeof(0))>(LBAL_bytes_);                       \
+                                                                               \
+      for (decltype(sizeof(0)) LBAL_prefetch_offset_{0};                       \
+           LBAL_prefetch_offset_ < LBAL_prefetch_bytes_;                       \
+           LBAL_prefetch_offset_ += LBAL_TARGET_CACHE_LINE_SIZE) {             \
+        LBAL_HINT_prefetch(LBAL_prefetch_base_ + LBAL_prefetch_offset_, 0, 3); \
+      }                                                                        \
+                                                                               \
+      if (LBAL_prefetch_bytes_) {                                              \
+        LBAL_HINT_prefetch(                                                    \
+            LBAL_prefetch_base_ + (LBAL_prefetch_bytes_ - 1), 0, 3);           \
+      }                                                                        \
+    } while (false)
+#endif
+
+/*------------------------------------------------------------------------------
+  Set up cold-path outlining.
+
+  SEEME - bitweeder
+  This is built strictly on the `LBAL_LAMBDA_xxx` decorators, which are
+  empty where unsupported, leaving an ordinary immediately-invoked lambda.
+*/
+
+#define LBAL_COLD_PATH(...)                                                    \
+  [&]() LBAL_LAMBDA_NOINLINE LBAL_LAMBDA_COLD { __VA_ARGS__; }()
+
+/*------------------------------------------------------------------------------
+  Set up statement-level branch hints.
+
+  SEEME - bitweeder
+  These depend on the SD-6 attribute tests, so they can’t live in the
+  compiler-specific headers. Clang reports the attributes in C++17 as well,
+  but warns that they’re an extension there, so we hold off until C++20.
+*/
+
+#if LBAL_CPP20_ATTRIBUTE_LIKELY                                                \
+    && !(LBAL_TARGET_COMPILER_CLANG && (__cplusplus < 202002L))
+  #define LBAL_LIKELY [[likely]]
+#endif
+
+#if LBAL_CPP20_ATTRIBUTE_UNLIKELY                                              \
+    && !(LBAL_TARGET_COMPILER_CLANG && (__cplusplus < 202002L))
+  #define LBAL_UNLIKELY [[unlikely]]
+#endif
+
+/*------------------------------------------------------------------------------
+  Set up alignment assumptions.
+
+  SEEME - bitweeder
+  The checked and MSVC forms go through an immediately-invoked lambda so that
+  the pointer is only evaluated once; `std::assume_aligned` is only used as
+  a last resort, from `lbalLibrarySetup.hpp`, since it requires `<memory>`.
+*/
+
+#if LBAL_CONFIG_check_assumptions
+  #define LBAL_HINT_assume_aligned(LBAL_ptr_, LBAL_alignment_)                 \
+    [](decltype(+(LBAL_ptr_)) LBAL_aligned_ptr_) {                             \
+      if (reinterpret_cast<decltype(sizeof(0))>(LBAL_aligned_ptr_)             \
+          % (LBAL_alignment_)) {                                               \
+        LBAL_::details::check_failed("misaligned pointer",                     \
+            #LBAL_ptr_ " aligned to " #LBAL_alignment_, __FILE__, __LINE__);   \
+      }                                                                        \
+                                                                               \
+      return LBAL_aligned_ptr_;                                                \
+    }(LBAL_ptr_)
+#elif LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC
+  #define LBAL_HINT_assume_aligned(LBAL_ptr_, LBAL_alignment_)                 \
+    static_cast<decltype(+(LBAL_ptr_))>(                                       \
+        __builtin_assume_aligned(LBAL_ptr_, LBAL_alignment_))
+#elif LBAL_TARGET_COMPILER_MSVC
+  #define LBAL_HINT_assume_aligned(LBAL_ptr_, LBAL_alignment_)                 \
+    [](decltype(+(LBAL_ptr_)) LBAL_aligned_ptr_) {                             \
+      __assume(0                                                               \
+          == (reinterpret_cast<decltype(sizeof(0))>(LBAL_aligned_ptr_)         \
+              % (LBAL_alignment_)));                                           \
+                                                                               \
+      return LBAL_aligned_ptr_;                                                \
+    }(LBAL_ptr_)
+#endif
+
+/*------------------------------------------------------------------------------
+  Set up compile-time branching.
+
+  SEEME - bitweeder
+  `std::is_constant_evaluated` is only used as a last resort, from
+  `lbalLibrarySetup.hpp`, since it requires `<type_traits>`; the builtin it
+  wraps is also available in C++17 on recent compilers.
+*/
+
+#if LBAL_CPP17_IF_CONSTEXPR
+  #define LBAL_IF_CONSTEXPR if constexpr
+#endif
+
+#if LBAL_CPP23_IF_CONSTEVAL
+  #define LBAL_IF_CONSTEVAL if consteval
+#elif defined(__has_builtin)
+  #if __has_builtin(__builtin_is_constant_evaluated)
+    #define LBAL_IF_CONSTEVAL if (__builtin_is_constant_evaluated())
+  #endif
+#endif
+
+/*------------------------------------------------------------------------------
+  Set up empty-member layout.
+
+  SEEME - bitweeder
+  This depends on the SD-6 attribute tests, so the Standard spelling can’t
+  be chosen in the compiler-specific headers; those only override it where
+  it would be silently ignored. As with `LBAL_LIKELY`, Clang is held to
+  C++20.
+*/
+
+#if !defined(LBAL_NO_UNIQUE_ADDRESS) && LBAL_CPP20_ATTRIBUTE_NO_UNIQUE_ADDRESS \
+    && !(LBAL_TARGET_COMPILER_CLANG && (__cplusplus < 202002L))
+  #define LBAL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
@@ -52,6 +52,10 @@
     #error "Don’t define LBAL_FEATURE_UTF16_FILE_SYSTEM externally."
   #endif  //	LBAL_FEATURE_UTF16_FILE_SYSTEM
 
+  #if defined(LBAL_FEATURE_MUSTTAIL) || defined(LBAL_MUSTTAIL)
+    #error "Don’t define LBAL_FEATURE_MUSTTAIL or LBAL_MUSTTAIL externally."
+  #endif  //	LBAL_FEATURE_MUSTTAIL
+
   #if defined(LBAL_NAME_COMPILER)
     #error "Don’t define LBAL_NAME_COMPILER externally."
   #endif  //	LBAL_NAME_COMPILER
@@ -87,7 +91,12 @@
       || defined(LBAL_TARGET_VEC_SSE41)                                        \
       || defined(LBAL_TARGET_VEC_SSE42)                                        \
       || defined(LBAL_TARGET_VEC_AVX)                                          \
-      || defined(LBAL_TARGET_VEC_AVX2)
+      || defined(LBAL_TARGET_VEC_AVX2)                                         \
+      || defined(LBAL_TARGET_VEC_AVX512F)                                      \
+      || defined(LBAL_TARGET_VEC_NEON)                                         \
+      || defined(LBAL_TARGET_VEC_SVE)                                          \
+      || defined(LBAL_TARGET_VEC_NATIVE_BYTES)                                 \
+      || defined(LBAL_TARGET_VEC_REGISTER_COUNT)
 
     #error "Don’t define LBAL_TARGET_VEC_xxx externally."
   #endif  //	LBAL_TARGET_VEC check
@@ -443,18 +452,56 @@
     #error "Don’t define LBAL_C99_xxx externally."
   #endif  //	LBAL_C99 check
 
-  #if defined(LBAL_CLASS_FORCE_EBCO)
+  #if defined(LBAL_CLASS_FORCE_EBCO) || defined(LBAL_CLASS_TRIVIAL_ABI)
     #error "Don’t define LBAL_CLASS_xxx externally."
   #endif  //	LBAL_CLASS_xxx check
 
   #if defined(LBAL_FUNC_CALL_C)                                                \
       || defined(LBAL_FUNC_CALL_STD)                                           \
       || defined(LBAL_FUNC_CALLBACK_C)                                         \
-      || defined(LBAL_FUNC_CALLBACK_STD)
+      || defined(LBAL_FUNC_CALLBACK_STD)                                       \
+      || defined(LBAL_FUNC_CALL_VECTOR)                                        \
+      || defined(LBAL_FUNC_CALL_REGCALL)                                       \
+      || defined(LBAL_FUNC_PRESERVE_MOST)                                      \
+      || defined(LBAL_FUNC_PRESERVE_NONE)                                      \
+      || defined(LBAL_FUNC_FORCE_INLINE)                                       \
+      || defined(LBAL_FUNC_NOINLINE)                                           \
+      || defined(LBAL_FUNC_FLATTEN)                                            \
+      || defined(LBAL_FUNC_HOT)                                                \
+      || defined(LBAL_FUNC_COLD)                                               \
+      || defined(LBAL_FUNC_MALLOC)                                             \
+      || defined(LBAL_FUNC_ALLOC_SIZE)                                         \
+      || defined(LBAL_FUNC_ALLOC_ALIGN)                                        \
+      || defined(LBAL_FUNC_PURE)                                               \
+      || defined(LBAL_FUNC_CONST)                                              \
+      || defined(LBAL_FUNC_NONNULL)                                            \
+      || defined(LBAL_FUNC_RETURNS_NONNULL)                                    \
+      || defined(LBAL_FUNC_ASSUME_ALIGNED_RETURN)                              \
+      || defined(LBAL_FUNC_NOPLT)                                              \
+      || defined(LBAL_FUNC_HOT_TEXT)                                           \
+      || defined(LBAL_FUNC_COLD_TEXT)
 
     #error "Don’t define LBAL_FUNC_xxx externally."
   #endif  //	LBAL_FUNC_xxx check
 
+  #if defined(LBAL_RESTRICT)
+    #error "Don’t define LBAL_RESTRICT externally."
+  #endif  //	LBAL_RESTRICT check
+
+  #if defined(LBAL_NO_UNIQUE_ADDRESS)
+    #error "Don’t define LBAL_NO_UNIQUE_ADDRESS externally."
+  #endif  //	LBAL_NO_UNIQUE_ADDRESS check
+
+  #if defined(LBAL_SECTION)
+    #error "Don’t define LBAL_SECTION externally."
+  #endif  //	LBAL_SECTION check
+
+  #if defined(LBAL_LAMBDA_FORCE_INLINE)                                        \
+      || defined(LBAL_LAMBDA_NOINLINE)                                         \
+      || defined(LBAL_LAMBDA_COLD)
+    #error "Don’t define LBAL_LAMBDA_xxx externally."
+  #endif  //	LBAL_LAMBDA_xxx check
+
   #if defined(LBAL_DIAGNOSTIC_PUSH)                                            \
       || defined(LBAL_DIAGNOSTIC_POP)                                          \
       || defined(LBAL_DIAGNOSTIC_DISABLE_UNKNOWN_PRAGMAS)
@@ -470,7 +517,41 @@
     #error "Don’t define LBAL_CPP_WARNING externally."
   #endif  //	LBAL_CPP_WARNING check
 
-  #if defined(LBAL_HINT_likely) || defined(LBAL_HINT_unlikely)
+  #if defined(LBAL_LOOP_UNROLL)                                                \
+      || defined(LBAL_LOOP_NO_UNROLL)                                          \
+      || defined(LBAL_LOOP_VECTORIZE)                                          \
+      || defined(LBAL_LOOP_IVDEP)                                              \
+      || defined(LBAL_LOOP_VECTORIZE_WIDTH)
+
+    #error "Don’t define LBAL_LOOP_xxx externally."
+  #endif  //	LBAL_LOOP_xxx check
+
+  #if defined(LBAL_BUILD_PIC) || defined(LBAL_BUILD_PIE)
+    #error "Don’t define LBAL_BUILD_PIC or LBAL_BUILD_PIE externally."
+  #endif  //	LBAL_BUILD_xxx check
+
+  #if defined(LBAL_TLS_INITIAL_EXEC)                                           \
+      || defined(LBAL_TLS_LOCAL_EXEC)                                          \
+      || defined(LBAL_TLS_LOCAL_DYNAMIC)
+
+    #error "Don’t define LBAL_TLS_xxx externally."
+  #endif  //	LBAL_TLS_xxx check
+
+  #if defined(LBAL_HINT_likely)                                                \
+      || defined(LBAL_HINT_unlikely)                                           \
+      || defined(LBAL_HINT_expect_probability)                                 \
+      || defined(LBAL_HINT_unpredictable)                                      \
+      || defined(LBAL_LIKELY)                                                  \
+      || defined(LBAL_UNLIKELY)                                                \
+      || defined(LBAL_HINT_assume)                                             \
+      || defined(LBAL_HINT_unreachable)                                        \
+      || defined(LBAL_HINT_assume_aligned)                                     \
+      || defined(LBAL_HINT_prefetch)                                           \
+      || defined(LBAL_HINT_prefetch_range)                                     \
+      || defined(LBAL_COLD_PATH)                                               \
+      || defined(LBAL_IS_CONSTANT_P)                                           \
+      || defined(LBAL_IF_CONSTEVAL)                                            \
+      || defined(LBAL_IF_CONSTEXPR)
 
     #error "Don’t define LBAL_BUILTIN_xxx externally."
   #endif  //	LBAL_BUILTIN_xxx check
@@ -8389,3 +8389,29 @@ LBAL_CPP_WARNING(
     #define LBAL_LIBCPP17_STANDARDIZATION_OF_PARALLELISM_TS 1L
   #endif
 #endif  //	LBAL_LIBCPP17_STANDARDIZATION_OF_PARALLELISM_TS
+
+/*------------------------------------------------------------------------------
+  Library-dependent Hints
+
+  These fill in for compilers we have no builtin for; they must wait until
+  the relevant library tokens have been validated.
+*/
+
+//	SEEME - bitweeder
+//	The client is responsible for including `<utility>` in this case.
+#if !defined(LBAL_HINT_unreachable) && LBAL_LIBCPP23_UNREACHABLE
+  #define LBAL_HINT_unreachable() ::std::unreachable()
+#endif
+
+//	SEEME - bitweeder
+//	The client is responsible for including `<memory>` in this case.
+#if !defined(LBAL_HINT_assume_aligned) && LBAL_LIBCPP20_ASSUME_ALIGNED
+  #define LBAL_HINT_assume_aligned(LBAL_ptr_, LBAL_alignment_)                 \
+    ::std::assume_aligned<(LBAL_alignment_)>(LBAL_ptr_)
+#endif
+
+//	SEEME - bitweeder
+//	The client is responsible for including `<type_traits>` in this case.
+#if !defined(LBAL_IF_CONSTEVAL) && LBAL_LIBCPP20_IS_CONSTANT_EVALUATED
+  #define LBAL_IF_CONSTEVAL if (::std::is_constant_evaluated())
+#endif
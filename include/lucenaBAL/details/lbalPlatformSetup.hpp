@@ -33,3 +33,48 @@
   #error                                                                       \
       "Unknown platform; update lbalPlatformSetup.hpp or specify a recognized platform token"
 #endif
+
+/*------------------------------------------------------------------------------
+  Memory Hierarchy Defaults
+
+  These are compile-time best guesses keyed off the target CPU; platform
+  headers may have already supplied more specific values, and clients may
+  override them outright from the build system. Runtime values are available
+  from `<lucenaBAL/lbalPlatformInfo.hpp>`.
+*/
+
+#ifndef LBAL_TARGET_CACHE_LINE_SIZE
+  #if LBAL_TARGET_CPU_FAMILY_X86 || LBAL_TARGET_CPU_IA64
+    #define LBAL_TARGET_CACHE_LINE_SIZE 64
+  #elif LBAL_TARGET_CPU_ARM_64 || LBAL_TARGET_CPU_ARM
+    #define LBAL_TARGET_CACHE_LINE_SIZE 64
+  #endif
+#endif
+
+//	SEEME - bitweeder
+//	Intel’s L2 spatial prefetcher and the Neoverse/Cortex-A prefetchers both
+//	pull in lines in aligned pairs, so two objects 64 bytes apart can still
+//	ping-pong between cores; we pad to the pair.
+#ifndef LBAL_TARGET_CACHE_INTERFERENCE_SIZE
+  #if LBAL_TARGET_CPU_FAMILY_X86 || LBAL_TARGET_CPU_IA64
+    #define LBAL_TARGET_CACHE_INTERFERENCE_SIZE 128
+  #elif LBAL_TARGET_CPU_ARM_64
+    #define LBAL_TARGET_CACHE_INTERFERENCE_SIZE 128
+  #elif LBAL_TARGET_CPU_ARM
+    #define LBAL_TARGET_CACHE_INTERFERENCE_SIZE 64
+  #endif
+#endif
+
+//	SEEME - bitweeder
+//	AArch64 Linux kernels may be built for 4 KiB, 16 KiB, or 64 KiB pages, and
+//	nothing in the compiler environment tells us which; we assume the common
+//	case, and clients targeting, e.g., RHEL on Neoverse should override this.
+#ifndef LBAL_TARGET_PAGE_SIZE_DEFAULT
+  #if LBAL_TARGET_CPU_FAMILY_X86
+    #define LBAL_TARGET_PAGE_SIZE_DEFAULT 4096
+  #elif LBAL_TARGET_CPU_IA64
+    #define LBAL_TARGET_PAGE_SIZE_DEFAULT 16384
+  #elif LBAL_TARGET_CPU_ARM_64 || LBAL_TARGET_CPU_ARM
+    #define LBAL_TARGET_PAGE_SIZE_DEFAULT 4096
+  #endif
+#endif
@@ -154,6 +154,22 @@
     #endif  //	LBAL_LIBCPP17_FILESYSTEM
   #endif
 
+  //	Apple Silicon uses 128-byte cache lines throughout the hierarchy, and
+  //	the kernel uses 16 KiB pages on every arm64 device.
+  #if LBAL_TARGET_CPU_ARM_64
+    #ifndef LBAL_TARGET_PAGE_SIZE_DEFAULT
+      #define LBAL_TARGET_PAGE_SIZE_DEFAULT 16384
+    #endif
+
+    #ifndef LBAL_TARGET_CACHE_LINE_SIZE
+      #define LBAL_TARGET_CACHE_LINE_SIZE 128
+    #endif
+
+    #ifndef LBAL_TARGET_CACHE_INTERFERENCE_SIZE
+      #define LBAL_TARGET_CACHE_INTERFERENCE_SIZE 128
+    #endif
+  #endif
+
   //	Set up identifiers
   #if defined(__MAC_OS_X_VERSION_MIN_REQUIRED)
     #define LBAL_NAME_TARGET_OS                                                \
@@ -0,0 +1,221 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalPlatformInfoApple.hpp”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+  Internal support for the runtime queries in `lbalPlatformInfo.hpp`; this
+  is not part of the public interface.
+
+------------------------------------------------------------------------------*/
+
+#pragma once
+
+//	lbal
+#include <lucenaBAL/lucenaBAL.hpp>
+
+//	std
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+//	Darwin
+#include <sys/sysctl.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+/*------------------------------------------------------------------------------
+  Apple Platforms
+
+  Everything comes from `sysctlbyname`. On Apple Silicon the `hw.perflevelN`
+  hierarchy describes each core type separately, with `perflevel0` being the
+  performance cores; the flat `hw.*` keys describe whichever cores the kernel
+  considers representative, and are all we get on Intel Macs.
+*/
+
+//	This duplicates the test peformed to include this file in the first place.
+#if !LBAL_TARGET_OS_MACOS && !LBAL_TARGET_OS_IOS && !LBAL_TARGET_OS_IOS_SIM
+  #error                                                                       \
+      "lbalPlatformInfoApple.hpp was directly included by a non-Apple platform"
+#endif
+
+LBAL_begin_v_namespace
+
+namespace details {
+
+//	Read an integral sysctl of either width; returns `0` on failure.
+inline std::uint64_t
+sysctl_value(char const * in_name) noexcept {
+  std::uint64_t value{0};
+  std::size_t length{sizeof(value)};
+
+  if (0 != ::sysctlbyname(in_name, &value, &length, nullptr, 0)) return 0;
+
+  if (sizeof(std::uint32_t) == length) {
+    std::uint32_t narrow{0};
+
+    length = sizeof(narrow);
+
+    if (0 != ::sysctlbyname(in_name, &narrow, &length, nullptr, 0)) return 0;
+
+    return narrow;
+  }
+
+  return value;
+}
+
+inline bool
+query_cache_hierarchy(cache_hierarchy & io_caches) {
+  auto const first_of = [](char const * in_preferred,
+                            char const * in_fallback) {
+    auto const value = sysctl_value(in_preferred);
+
+    return static_cast<std::size_t>(value ? value : sysctl_value(in_fallback));
+  };
+
+  std::size_t const line_size{
+      static_cast<std::size_t>(sysctl_value("hw.cachelinesize"))};
+
+  io_caches.l1d.size =
+      first_of("hw.perflevel0.l1dcachesize", "hw.l1dcachesize");
+  io_caches.l1i.size =
+      first_of("hw.perflevel0.l1icachesize", "hw.l1icachesize");
+  io_caches.l2.size =
+      first_of("hw.perflevel0.l2cachesize", "hw.l2cachesize");
+  io_caches.l3.size =
+      first_of("hw.perflevel0.l3cachesize", "hw.l3cachesize");
+
+  for (auto * level : {&io_caches.l1d, &io_caches.l1i, &io_caches.l2,
+           &io_caches.l3}) {
+    if (level->size) level->line_size = line_size;
+  }
+
+  //	L1 is always private; L2 is shared per cluster on Apple Silicon.
+  if (io_caches.l1d.size) io_caches.l1d.shared_by = 1;
+  if (io_caches.l1i.size) io_caches.l1i.shared_by = 1;
+
+  if (io_caches.l2.size) {
+    io_caches.l2.shared_by =
+        static_cast<unsigned>(sysctl_value("hw.perflevel0.cpusperl2"));
+  }
+
+  if (io_caches.l3.size) {
+    io_caches.l3.shared_by =
+        static_cast<unsigned>(sysctl_value("hw.perflevel0.cpusperl3"));
+  }
+
+  return 0 != io_caches.l1d.size;
+}
+
+inline std::size_t
+query_page_size() noexcept {
+  long const size{::sysconf(_SC_PAGESIZE)};
+
+  return (size > 0) ? static_cast<std::size_t>(size) : 0;
+}
+
+//	SEEME - bitweeder
+//	Intel Macs can map 2 MiB superpages through `mach_vm_allocate`, but that
+//	is not something a portable allocator can lean on, and Apple Silicon has
+//	no equivalent; we report none.
+inline void
+query_huge_page_sizes(std::vector<std::size_t> & o_sizes) {
+  static_cast<void>(o_sizes);
+}
+
+inline thp_mode
+query_thp_mode() noexcept {
+  return thp_mode::unsupported;
+}
+
+inline std::size_t
+query_physical_memory() noexcept {
+  return static_cast<std::size_t>(sysctl_value("hw.memsize"));
+}
+
+//	Apple hardware is uniformly UMA.
+inline bool
+query_numa_topology(numa_topology_info & io_topology) noexcept {
+  static_cast<void>(io_topology);
+
+  return false;
+}
+
+//	Each `hw.perflevelN` describes one core type, fastest first. Darwin has
+//	no public CPU numbering, and no thread affinity to use it with, so the
+//	identifiers are nominal: each perflevel’s logical CPUs are numbered
+//	consecutively, SMT siblings (Intel Macs only) adjacent, with each run of
+//	`cpusperl2` CPUs forming a cache group.
+inline bool
+query_cpu_topology(cpu_topology_info & io_topology) {
+  auto const levels = sysctl_value("hw.nperflevels");
+
+  if (!levels) return false;
+
+  unsigned next_id{0};
+
+  for (std::uint64_t level{0}; level < levels; ++level) {
+    std::string const prefix{"hw.perflevel" + std::to_string(level) + "."};
+    auto const logical = sysctl_value((prefix + "logicalcpu").c_str());
+    auto const physical = sysctl_value((prefix + "physicalcpu").c_str());
+
+    if (!logical || !physical || (logical % physical)) return false;
+
+    auto const threads = static_cast<unsigned>(logical / physical);
+    auto per_l2 = static_cast<unsigned>(
+        sysctl_value((prefix + "cpusperl2").c_str()));
+
+    if (!per_l2 || (per_l2 > logical)) per_l2 = static_cast<unsigned>(logical);
+
+    auto const kind =
+        (0 == level) ? core_kind::performance : core_kind::efficiency;
+    unsigned const first_id{next_id};
+    std::vector<unsigned> cluster;
+
+    for (std::uint64_t core{0}; core < physical; ++core) {
+      std::vector<unsigned> siblings;
+
+      for (unsigned thread{0}; thread < threads; ++thread) {
+        siblings.push_back(next_id++);
+      }
+
+      auto const core_index = group_index(io_topology.cores, siblings);
+
+      for (auto const id : siblings) {
+        logical_cpu cpu;
+
+        cpu.id = id;
+        cpu.core = core_index;
+        cpu.kind = kind;
+
+        io_topology.cpus.push_back(cpu);
+      }
+    }
+
+    for (unsigned id{first_id}; id < next_id; ++id) {
+      cluster.push_back(id);
+
+      if ((per_l2 == cluster.size()) || (next_id == id + 1)) {
+        auto const group = group_index(io_topology.cache_groups, cluster);
+
+        for (auto const member : cluster) {
+          io_topology.cpus[member].cache_group = group;
+        }
+
+        cluster.clear();
+      }
+    }
+  }
+
+  return !io_topology.cpus.empty();
+}
+
+}  //	namespace details
+
+LBAL_end_v_namespace
@@ -0,0 +1,586 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalPlatformInfoPOSIX.hpp”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+  Internal support for the runtime queries in `lbalPlatformInfo.hpp`; this
+  is not part of the public interface.
+
+------------------------------------------------------------------------------*/
+
+#pragma once
+
+//	lbal
+#include <lucenaBAL/lucenaBAL.hpp>
+
+//	std
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//	POSIX
+#include <dirent.h>
+#include <sched.h>
+#include <unistd.h>
+
+/*------------------------------------------------------------------------------
+  POSIX Platforms
+
+  Linux exposes nearly everything we need through sysfs, with `sysconf` as a
+  backstop for the basics. The BSDs have no equivalent that is worth the
+  trouble, so beyond the portable `sysconf` queries we report nothing and
+  let the `cpuid` fallback and the compile-time estimates take over.
+*/
+
+//	This duplicates the test peformed to include this file in the first place.
+#if !LBAL_TARGET_OS_X11
+  #error                                                                       \
+      "lbalPlatformInfoPOSIX.hpp was directly included by a non-POSIX platform"
+#endif
+
+LBAL_begin_v_namespace
+
+namespace details {
+
+//	Read the first line of a (typically sysfs or procfs) text file, sans the
+//	trailing newline. Returns `false` if the file can’t be read. Lines may be
+//	arbitrarily long, e.g., the cpu lists of a large, sparse machine.
+inline bool
+read_first_line(char const * in_path, std::string & o_line) {
+  std::ifstream file{in_path};
+
+  if (!file || !std::getline(file, o_line)) return false;
+
+  while (!o_line.empty() && ('\r' == o_line.back())) o_line.pop_back();
+
+  return true;
+}
+
+//	Parse sizes of the form “48K”, “2048 kB”, or “1M”; returns `0` on failure.
+inline std::size_t
+parse_size(std::string const & in_text) noexcept {
+  std::size_t value{0};
+  std::size_t pos{0};
+
+  for (; (pos < in_text.size()) && ('0' <= in_text[pos])
+         && ('9' >= in_text[pos]);
+       ++pos) {
+    value = (value * 10) + static_cast<std::size_t>(in_text[pos] - '0');
+  }
+
+  if (0 == pos) return 0;
+
+  while ((pos < in_text.size()) && (' ' == in_text[pos])) ++pos;
+
+  if (pos < in_text.size()) {
+    switch (in_text[pos]) {
+      case 'K':
+      case 'k':
+        value *= std::size_t{1} << 10;
+        break;
+
+      case 'M':
+      case 'm':
+        value *= std::size_t{1} << 20;
+        break;
+
+      case 'G':
+      case 'g':
+        value *= std::size_t{1} << 30;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  return value;
+}
+
+//	Parse a run of decimal digits at `io_pos`, advancing past it; fails if
+//	there are none, or if the value doesn’t fit.
+inline bool
+parse_decimal(
+    std::string const & in_text,
+    std::size_t & io_pos,
+    unsigned & o_value
+) noexcept {
+  std::size_t const start{io_pos};
+
+  o_value = 0;
+
+  for (; (io_pos < in_text.size()) && ('0' <= in_text[io_pos])
+         && ('9' >= in_text[io_pos]);
+       ++io_pos) {
+    auto const digit = static_cast<unsigned>(in_text[io_pos] - '0');
+
+    if (o_value > (static_cast<unsigned>(-1) - digit) / 10) return false;
+
+    o_value = (o_value * 10) + digit;
+  }
+
+  return start != io_pos;
+}
+
+//	Expand a kernel cpu or node list, e.g., “0-3,8” yields {0, 1, 2, 3, 8}.
+//	Malformed lists, including reversed ranges, yield an empty result rather
+//	than a partial one.
+inline std::vector<unsigned>
+parse_cpu_list(std::string const & in_list) {
+  std::vector<unsigned> result;
+  std::size_t pos{0};
+  std::size_t const end{in_list.find_last_not_of(" \t") + 1};
+
+  while (pos < end) {
+    unsigned first{0};
+    unsigned last{0};
+
+    if (!parse_decimal(in_list, pos, first)) return {};
+
+    last = first;
+
+    if ((pos < end) && ('-' == in_list[pos])) {
+      ++pos;
+
+      if (!parse_decimal(in_list, pos, last) || (last < first)) return {};
+    }
+
+    for (auto cpu = first;; ++cpu) {
+      result.push_back(cpu);
+
+      if (cpu == last) break;
+    }
+
+    if (pos == end) break;
+
+    if ((',' != in_list[pos]) || (++pos == end)) return {};
+  }
+
+  return result;
+}
+
+//	Split a node’s row of the NUMA distance matrix, e.g., “10 21 31”, which
+//	has one entry per online node; malformed rows yield an empty result.
+inline std::vector<unsigned>
+parse_distance_row(std::string const & in_row) {
+  std::vector<unsigned> result;
+  std::size_t pos{0};
+
+  while (true) {
+    pos = in_row.find_first_not_of(" \t", pos);
+
+    if (std::string::npos == pos) break;
+
+    unsigned distance{0};
+
+    if (!parse_decimal(in_row, pos, distance)
+        || ((pos < in_row.size()) && (' ' != in_row[pos])
+            && ('\t' != in_row[pos]))) {
+      return {};
+    }
+
+    result.push_back(distance);
+  }
+
+  return result;
+}
+
+//	Count the CPUs in a kernel cpu list, e.g., “0-3,8,10-11” yields 7.
+inline unsigned
+count_cpu_list(std::string const & in_list) {
+  return static_cast<unsigned>(parse_cpu_list(in_list).size());
+}
+
+inline bool
+query_cache_hierarchy(cache_hierarchy & io_caches) {
+#if defined(__linux__)
+  bool found{false};
+
+  for (unsigned index{0}; index < 16; ++index) {
+    std::string const base{
+        "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index)
+        + "/"};
+    std::string level;
+    std::string type;
+
+    if (!read_first_line((base + "level").c_str(), level)
+        || !read_first_line((base + "type").c_str(), type)) {
+      break;
+    }
+
+    cache_level * target{nullptr};
+
+    if ("1" == level) {
+      if ("Data" == type) {
+        target = &io_caches.l1d;
+      } else if ("Instruction" == type) {
+        target = &io_caches.l1i;
+      }
+    } else if ("2" == level) {
+      target = &io_caches.l2;
+    } else if ("3" == level) {
+      target = &io_caches.l3;
+    }
+
+    if (!target) continue;
+
+    std::string text;
+
+    if (read_first_line((base + "size").c_str(), text)) {
+      target->size = parse_size(text);
+    }
+
+    if (read_first_line((base + "coherency_line_size").c_str(), text)) {
+      target->line_size = parse_size(text);
+    }
+
+    if (read_first_line((base + "ways_of_associativity").c_str(), text)) {
+      target->associativity = static_cast<unsigned>(parse_size(text));
+    }
+
+    if (read_first_line((base + "shared_cpu_list").c_str(), text)) {
+      target->shared_by = count_cpu_list(text);
+    }
+
+    found = found || (0 != target->size);
+  }
+
+  //	Containers and some embedded kernels hide sysfs; glibc can often still
+  //	answer through `sysconf`, at least for the first couple of levels.
+  #if defined(_SC_LEVEL1_DCACHE_SIZE)
+  auto const fill = [](cache_level & io_level, int in_size, int in_line,
+                        int in_assoc) {
+    if (io_level.size) return;
+
+    long const size{::sysconf(in_size)};
+    long const line{::sysconf(in_line)};
+    long const assoc{::sysconf(in_assoc)};
+
+    if (size > 0) io_level.size = static_cast<std::size_t>(size);
+    if (line > 0) io_level.line_size = static_cast<std::size_t>(line);
+    if (assoc > 0) io_level.associativity = static_cast<unsigned>(assoc);
+  };
+
+  fill(io_caches.l1d, _SC_LEVEL1_DCACHE_SIZE, _SC_LEVEL1_DCACHE_LINESIZE,
+      _SC_LEVEL1_DCACHE_ASSOC);
+  fill(io_caches.l1i, _SC_LEVEL1_ICACHE_SIZE, _SC_LEVEL1_ICACHE_LINESIZE,
+      _SC_LEVEL1_ICACHE_ASSOC);
+  fill(io_caches.l2, _SC_LEVEL2_CACHE_SIZE, _SC_LEVEL2_CACHE_LINESIZE,
+      _SC_LEVEL2_CACHE_ASSOC);
+  fill(io_caches.l3, _SC_LEVEL3_CACHE_SIZE, _SC_LEVEL3_CACHE_LINESIZE,
+      _SC_LEVEL3_CACHE_ASSOC);
+
+  found = found || (0 != io_caches.l1d.size);
+  #endif
+
+  return found;
+#else
+  static_cast<void>(io_caches);
+
+  return false;
+#endif
+}
+
+inline std::size_t
+query_page_size() noexcept {
+  long const size{::sysconf(_SC_PAGESIZE)};
+
+  return (size > 0) ? static_cast<std::size_t>(size) : 0;
+}
+
+inline void
+query_huge_page_sizes(std::vector<std::size_t> & o_sizes) {
+#if defined(__linux__)
+  //	Each supported size gets a directory named, e.g., “hugepages-2048kB”.
+  ::DIR * directory{::opendir("/sys/kernel/mm/hugepages")};
+
+  if (!directory) return;
+
+  char const prefix[]{"hugepages-"};
+
+  while (::dirent const * entry{::readdir(directory)}) {
+    if (0 != std::strncmp(entry->d_name, prefix, sizeof(prefix) - 1)) continue;
+
+    auto const size = parse_size(entry->d_name + sizeof(prefix) - 1);
+
+    if (size) o_sizes.push_back(size);
+  }
+
+  ::closedir(directory);
+
+  std::sort(o_sizes.begin(), o_sizes.end());
+#else
+  static_cast<void>(o_sizes);
+#endif
+}
+
+inline thp_mode
+query_thp_mode() {
+#if defined(__linux__)
+  //	The active setting is bracketed, e.g., “always [madvise] never”.
+  std::string text;
+
+  if (!read_first_line("/sys/kernel/mm/transparent_hugepage/enabled", text)) {
+    return thp_mode::unsupported;
+  }
+
+  if (std::string::npos != text.find("[always]")) return thp_mode::always;
+  if (std::string::npos != text.find("[madvise]")) return thp_mode::madvise;
+  if (std::string::npos != text.find("[never]")) return thp_mode::never;
+#endif
+
+  return thp_mode::unsupported;
+}
+
+inline std::size_t
+query_physical_memory() noexcept {
+#if defined(_SC_PHYS_PAGES)
+  long const pages{::sysconf(_SC_PHYS_PAGES)};
+  long const size{::sysconf(_SC_PAGESIZE)};
+
+  if ((pages > 0) && (size > 0)) {
+    return static_cast<std::size_t>(pages) * static_cast<std::size_t>(size);
+  }
+#endif
+
+  return 0;
+}
+
+inline bool
+query_numa_topology(numa_topology_info & io_topology) {
+#if defined(__linux__)
+  std::string text;
+
+  if (!read_first_line("/sys/devices/system/node/online", text)) return false;
+
+  auto const ids = parse_cpu_list(text);
+
+  if (ids.empty()) return false;
+
+  for (auto const id : ids) {
+    std::string const base{
+        "/sys/devices/system/node/node" + std::to_string(id) + "/"};
+    numa_node node;
+
+    node.id = id;
+
+    if (read_first_line((base + "cpulist").c_str(), text)) {
+      node.cpus = parse_cpu_list(text);
+    }
+
+    //	The first line reads, e.g., “Node 0 MemTotal:   5209848 kB”.
+    if (read_first_line((base + "meminfo").c_str(), text)) {
+      auto const label = text.find("MemTotal:");
+
+      if (std::string::npos != label) {
+        auto const value = text.find_first_not_of(' ', label + 9);
+
+        if (std::string::npos != value) {
+          node.memory = parse_size(text.substr(value));
+        }
+      }
+    }
+
+    //	One entry per online node, in the same order as “online”.
+    if (read_first_line((base + "distance").c_str(), text)) {
+      node.distances = parse_distance_row(text);
+    }
+
+    io_topology.nodes.push_back(std::move(node));
+  }
+
+  return true;
+#else
+  static_cast<void>(io_topology);
+
+  return false;
+#endif
+}
+
+#if defined(__linux__)
+//	Find the cache directory of a CPU’s sysfs entry that describes the given
+//	level, e.g., “cache/index3/”. Index numbers don’t map to levels, since
+//	parts differ in how many caches they have per level, so each must be
+//	checked; returns an empty string if there is no such cache.
+inline std::string
+find_cache_index(std::string const & in_cpu_base, char const * in_level) {
+  std::string level;
+
+  for (unsigned index{0}; index < 16; ++index) {
+    std::string const directory{"cache/index" + std::to_string(index) + "/"};
+
+    if (!read_first_line((in_cpu_base + directory + "level").c_str(), level)) {
+      break;
+    }
+
+    if (in_level == level) return directory;
+  }
+
+  return {};
+}
+
+//	Classify hybrid x86 cores. Kernels from 5.13 on publish the membership of
+//	each core type as a PMU; failing that, a short-lived thread visits each
+//	CPU in turn and asks `cpuid` directly, so the calling thread is never
+//	moved and its affinity is never touched.
+inline void
+classify_hybrid_cpus(std::vector<logical_cpu> & io_cpus) {
+  std::string text;
+  bool classified{false};
+
+  if (read_first_line("/sys/devices/cpu_core/cpus", text)) {
+    for (auto const id : parse_cpu_list(text)) {
+      for (auto & cpu : io_cpus) {
+        if (id == cpu.id) cpu.kind = core_kind::performance;
+      }
+    }
+
+    classified = true;
+  }
+
+  if (read_first_line("/sys/devices/cpu_atom/cpus", text)) {
+    for (auto const id : parse_cpu_list(text)) {
+      for (auto & cpu : io_cpus) {
+        if (id == cpu.id) cpu.kind = core_kind::efficiency;
+      }
+    }
+
+    classified = true;
+  }
+
+  if (classified || !cpuid_is_hybrid()) return;
+
+  #if defined(CPU_SET)
+  //	Only the probing thread is ever pinned; a CPU it can’t be pinned to
+  //	simply stays unclassified.
+  auto const probe = [&io_cpus] {
+    for (auto & cpu : io_cpus) {
+      //	A fixed-size `cpu_set_t` can’t name CPUs past `CPU_SETSIZE`.
+      if (cpu.id >= CPU_SETSIZE) continue;
+
+      ::cpu_set_t single;
+
+      CPU_ZERO(&single);
+      CPU_SET(cpu.id, &single);
+
+      if (0 != ::sched_setaffinity(0, sizeof(single), &single)) continue;
+
+      switch (cpuid_core_type()) {
+        case 0x40:
+          cpu.kind = core_kind::performance;
+          break;
+
+        case 0x20:
+          cpu.kind = core_kind::efficiency;
+          break;
+
+        default:
+          break;
+      }
+    }
+  };
+
+    #if LBAL_CPP03_EXCEPTIONS
+  try {
+    std::thread{probe}.join();
+  } catch (std::system_error const &) {
+    //	No thread, no classification; the caller copes with `unknown`.
+  }
+    #else
+  std::thread{probe}.join();
+    #endif
+  #endif
+}
+#endif
+
+inline bool
+query_cpu_topology(cpu_topology_info & io_topology) {
+#if defined(__linux__)
+  std::string text;
+
+  if (!read_first_line("/sys/devices/system/cpu/online", text)) return false;
+
+  auto const ids = parse_cpu_list(text);
+
+  if (ids.empty()) return false;
+
+  //	Try each source in turn, returning the first list that can be read.
+  auto const read_list = [](std::string const & in_base,
+                             std::initializer_list<char const *> in_names,
+                             std::vector<unsigned> & o_list) {
+    std::string line;
+
+    for (auto const name : in_names) {
+      if (read_first_line((in_base + name).c_str(), line)) {
+        o_list = parse_cpu_list(line);
+
+        if (!o_list.empty()) return true;
+      }
+    }
+
+    return false;
+  };
+
+  for (auto const id : ids) {
+    std::string const base{
+        "/sys/devices/system/cpu/cpu" + std::to_string(id) + "/"};
+    logical_cpu cpu;
+    std::vector<unsigned> members;
+
+    cpu.id = id;
+
+    if (read_first_line((base + "topology/physical_package_id").c_str(),
+            text)) {
+      cpu.package = static_cast<unsigned>(parse_size(text));
+    }
+
+    if (!read_list(base,
+            {"topology/core_cpus_list", "topology/thread_siblings_list"},
+            members)) {
+      members.assign(1, id);
+    }
+
+    cpu.core = group_index(io_topology.cores, members);
+
+    std::string const l3{find_cache_index(base, "3")};
+
+    if ((l3.empty()
+            || !read_list(base, {(l3 + "shared_cpu_list").c_str()}, members))
+        && !read_list(base, {"topology/cluster_cpus_list"}, members)) {
+      members = ids;
+    }
+
+    cpu.cache_group = group_index(io_topology.cache_groups, members);
+
+    if (read_first_line((base + "cpu_capacity").c_str(), text)) {
+      cpu.capacity = static_cast<unsigned>(parse_size(text));
+    }
+
+    io_topology.cpus.push_back(cpu);
+  }
+
+  classify_hybrid_cpus(io_topology.cpus);
+
+  return true;
+#else
+  static_cast<void>(io_topology);
+
+  return false;
+#endif
+}
+
+}  //	namespace details
+
+LBAL_end_v_namespace
@@ -0,0 +1,299 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalPlatformInfoWinAPI.hpp”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+  Internal support for the runtime queries in `lbalPlatformInfo.hpp`; this
+  is not part of the public interface.
+
+------------------------------------------------------------------------------*/
+
+#pragma once
+
+//	lbal
+#include <lucenaBAL/lucenaBAL.hpp>
+
+//	std
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+//	Windows
+//	SEEME - bitweeder
+//	We deliberately leave `NOMINMAX` and `WIN32_LEAN_AND_MEAN` to the client,
+//	since `<windows.h>` is only processed once per translation unit; hence
+//	the parenthesized `(std::max)` below.
+#include <windows.h>
+
+/*------------------------------------------------------------------------------
+  Windows
+
+  `GetLogicalProcessorInformation` reports one record per cache instance; we
+  take the first instance at each level as representative.
+*/
+
+//	This duplicates the test peformed to include this file in the first place.
+#if !LBAL_TARGET_OS_WINAPI
+  #error                                                                       \
+      "lbalPlatformInfoWinAPI.hpp was directly included by a non-Windows platform"
+#endif
+
+LBAL_begin_v_namespace
+
+namespace details {
+
+//	Count the bits set in a processor affinity mask.
+inline unsigned
+count_mask_bits(ULONG_PTR in_mask) noexcept {
+  unsigned count{0};
+
+  for (; in_mask; in_mask &= in_mask - 1) ++count;
+
+  return count;
+}
+
+//	Fetch the full processor information array; empty on failure.
+inline std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION>
+logical_processor_information() {
+  DWORD length{0};
+
+  ::GetLogicalProcessorInformation(nullptr, &length);
+
+  std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> records(
+      length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+  if (records.empty() || !::GetLogicalProcessorInformation(records.data(),
+                             &length)) {
+    records.clear();
+  }
+
+  return records;
+}
+
+inline bool
+query_cache_hierarchy(cache_hierarchy & io_caches) {
+  bool found{false};
+
+  for (auto const & record : logical_processor_information()) {
+    if (RelationCache != record.Relationship) continue;
+
+    auto const & cache = record.Cache;
+    cache_level * target{nullptr};
+
+    if (1 == cache.Level) {
+      if (CacheData == cache.Type || CacheUnified == cache.Type) {
+        target = &io_caches.l1d;
+      } else if (CacheInstruction == cache.Type) {
+        target = &io_caches.l1i;
+      }
+    } else if (2 == cache.Level) {
+      target = &io_caches.l2;
+    } else if (3 == cache.Level) {
+      target = &io_caches.l3;
+    }
+
+    if (!target || target->size) continue;
+
+    target->size = cache.Size;
+    target->line_size = cache.LineSize;
+
+    //	0xFF denotes a fully-associative cache.
+    target->associativity =
+        (0xFF == cache.Associativity) ? 0u : unsigned{cache.Associativity};
+    target->shared_by = count_mask_bits(record.ProcessorMask);
+
+    found = true;
+  }
+
+  return found;
+}
+
+inline std::size_t
+query_page_size() noexcept {
+  SYSTEM_INFO info{};
+
+  ::GetSystemInfo(&info);
+
+  return info.dwPageSize;
+}
+
+inline void
+query_huge_page_sizes(std::vector<std::size_t> & o_sizes) {
+  auto const size = ::GetLargePageMinimum();
+
+  if (size) o_sizes.push_back(size);
+}
+
+inline thp_mode
+query_thp_mode() noexcept {
+  return thp_mode::unsupported;
+}
+
+inline std::size_t
+query_physical_memory() noexcept {
+  MEMORYSTATUSEX status{};
+
+  status.dwLength = sizeof(status);
+
+  return ::GlobalMemoryStatusEx(&status)
+      ? static_cast<std::size_t>(status.ullTotalPhys)
+      : 0;
+}
+
+//	FIXME - bitweeder
+//	This could be built on `GetLogicalProcessorInformationEx` with
+//	`RelationNumaNode`, but processor groups complicate the CPU numbering;
+//	for now, Windows is described as a single node.
+inline bool
+query_numa_topology(numa_topology_info & io_topology) noexcept {
+  static_cast<void>(io_topology);
+
+  return false;
+}
+
+//	Invoke `in_visitor` on each extended record of the given relationship.
+template <typename Visitor>
+void
+for_each_processor_record(
+    LOGICAL_PROCESSOR_RELATIONSHIP in_relationship,
+    Visitor in_visitor
+) {
+  DWORD length{0};
+
+  ::GetLogicalProcessorInformationEx(in_relationship, nullptr, &length);
+
+  std::vector<unsigned char> buffer(length);
+
+  if (buffer.empty()
+      || !::GetLogicalProcessorInformationEx(in_relationship,
+          reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(
+              buffer.data()),
+          &length)) {
+    return;
+  }
+
+  for (DWORD offset{0}; offset < length;) {
+    auto const & record =
+        *reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const *>(
+            buffer.data() + offset);
+
+    in_visitor(record);
+
+    offset += record.Size;
+  }
+}
+
+//	Expand a group affinity into CPU identifiers, numbering the processors in
+//	each group consecutively after those of the groups before it.
+inline void
+expand_group_affinity(
+    GROUP_AFFINITY const & in_affinity,
+    std::vector<unsigned> & io_cpus
+) {
+  auto const bits = static_cast<unsigned>(sizeof(KAFFINITY) * 8);
+
+  for (unsigned bit{0}; bit < bits; ++bit) {
+    if (in_affinity.Mask & (KAFFINITY{1} << bit)) {
+      io_cpus.push_back((unsigned{in_affinity.Group} * bits) + bit);
+    }
+  }
+}
+
+inline bool
+query_cpu_topology(cpu_topology_info & io_topology) {
+  std::vector<BYTE> classes;
+  BYTE max_class{0};
+
+  //	Windows reports a higher `EfficiencyClass` for faster cores, and `0`
+  //	everywhere on homogeneous systems.
+  for_each_processor_record(RelationProcessorCore, [&](auto const & in_record) {
+    std::vector<unsigned> members;
+
+    for (WORD group{0}; group < in_record.Processor.GroupCount; ++group) {
+      expand_group_affinity(in_record.Processor.GroupMask[group], members);
+    }
+
+    auto const core = group_index(io_topology.cores, members);
+
+    for (auto const id : members) {
+      logical_cpu cpu;
+
+      cpu.id = id;
+      cpu.core = core;
+
+      io_topology.cpus.push_back(cpu);
+      classes.push_back(in_record.Processor.EfficiencyClass);
+    }
+
+    max_class = (std::max)(max_class, in_record.Processor.EfficiencyClass);
+  });
+
+  if (io_topology.cpus.empty()) return false;
+
+  if (max_class) {
+    for (std::size_t index{0}; index < classes.size(); ++index) {
+      io_topology.cpus[index].kind = (max_class == classes[index])
+          ? core_kind::performance
+          : core_kind::efficiency;
+    }
+  }
+
+  auto const assign = [&io_topology](std::vector<unsigned> const & in_members,
+                          unsigned logical_cpu::*in_field,
+                          unsigned in_value) {
+    for (auto & cpu : io_topology.cpus) {
+      if (std::find(in_members.begin(), in_members.end(), cpu.id)
+          != in_members.end()) {
+        cpu.*in_field = in_value;
+      }
+    }
+  };
+
+  unsigned package{0};
+
+  for_each_processor_record(RelationProcessorPackage,
+      [&](auto const & in_record) {
+        std::vector<unsigned> members;
+
+        for (WORD group{0}; group < in_record.Processor.GroupCount; ++group) {
+          expand_group_affinity(in_record.Processor.GroupMask[group], members);
+        }
+
+        assign(members, &logical_cpu::package, package++);
+      });
+
+  for_each_processor_record(RelationCache, [&](auto const & in_record) {
+    if (3 != in_record.Cache.Level) return;
+
+    std::vector<unsigned> members;
+
+    expand_group_affinity(in_record.Cache.GroupMask, members);
+
+    assign(members, &logical_cpu::cache_group,
+        group_index(io_topology.cache_groups, members));
+  });
+
+  std::sort(io_topology.cpus.begin(), io_topology.cpus.end(),
+      [](logical_cpu const & in_lhs, logical_cpu const & in_rhs) {
+        return in_lhs.id < in_rhs.id;
+      });
+
+  if (io_topology.cache_groups.empty()) {
+    io_topology.cache_groups.emplace_back();
+
+    for (auto const & cpu : io_topology.cpus) {
+      io_topology.cache_groups.front().push_back(cpu.id);
+    }
+  }
+
+  return true;
+}
+
+}  //	namespace details
+
+LBAL_end_v_namespace
@@ -0,0 +1,559 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalBuiltins.hpp”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+------------------------------------------------------------------------------*/
+
+/**
+  @file lucenaBAL/lbalBuiltins.hpp
+
+  @brief C++ helpers layered on top of the lucenaBAL built-in and target
+  macros
+
+  @details Some facilities are awkward or impossible to express as bare
+  preprocessor macros, e.g., anything that needs to be a type-dependent
+  constant or a function template. Those live here, built strictly on the
+  tokens exposed by `<lucenaBAL/lucenaBAL.hpp>`.
+
+  @remarks Unlike the metaheader, this header is not included by default, as
+  it requires C++17 and may pull in additional Standard Library headers.
+  Include it explicitly where needed.
+*/
+
+#pragma once
+
+//	lbal
+#include <lucenaBAL/lucenaBAL.hpp>
+
+//	std
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if LBAL_TARGET_COMPILER_MSVC
+  #include <intrin.h>
+#elif !LBAL_TARGET_COMPILER_CLANG && !LBAL_TARGET_COMPILER_GCC
+  #include <atomic>
+#endif
+
+#if LBAL_TARGET_VEC_SSE2
+  #include <immintrin.h>
+#endif
+
+#if LBAL_cpp_version < LBAL_CPP17_VERSION
+  #error "lbalBuiltins.hpp requires C++17 or later"
+#endif
+
+/**
+  @addtogroup lbal_builtins
+
+  @{
+*/
+
+LBAL_begin_v_namespace
+
+/**
+  @brief Number of lanes of type `T` that fit in a native vector register
+
+  @details This is `LBAL_TARGET_VEC_NATIVE_BYTES / sizeof(T)`, clamped to a
+  minimum of `1`, so it is always safe to use as a block or unroll factor,
+  even when no vector instruction set is available.
+
+  @tparam T An arithmetic (or otherwise trivially-copyable) lane type
+*/
+template <typename T>
+inline constexpr std::size_t native_simd_lanes =
+    (LBAL_TARGET_VEC_NATIVE_BYTES / sizeof(T)) > 0
+        ? (LBAL_TARGET_VEC_NATIVE_BYTES / sizeof(T))
+        : 1;
+
+namespace details {
+
+template <std::size_t Size>
+struct select_bits {};
+
+template <>
+struct select_bits<1> {
+  using type = std::uint8_t;
+};
+
+template <>
+struct select_bits<2> {
+  using type = std::uint16_t;
+};
+
+template <>
+struct select_bits<4> {
+  using type = std::uint32_t;
+};
+
+template <>
+struct select_bits<8> {
+  using type = std::uint64_t;
+};
+
+//	SEEME - bitweeder
+//	The empty `asm` hides the mask’s provenance from the optimizer, which
+//	would otherwise be free to recognize the blend below as a select and
+//	lower it to a branch, e.g., through LLVM’s x86 CMOV conversion pass.
+template <typename Bits>
+LBAL_FUNC_FORCE_INLINE Bits
+select_mask(bool in_condition) noexcept {
+  auto mask = static_cast<Bits>(-static_cast<Bits>(in_condition));
+
+#if LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC
+  __asm__("" : "+r"(mask));
+#endif
+
+  return mask;
+}
+
+}  //	namespace details
+
+/**
+  @brief Branchless choice between two values
+
+  @details This returns `in_true` if `in_condition` holds and `in_false`
+  otherwise, like the conditional operator, but both arguments are always
+  evaluated and the choice is made arithmetically, by blending the two
+  object representations through a mask. The result compiles to a
+  conditional move, or to a short sequence of logical operations, and never
+  to a branch, which makes it suitable for data-dependent choices that
+  would otherwise be mispredicted often, e.g., in sorting networks.
+
+  @remarks Prefer the conditional operator, optionally paired with
+  `LBAL_HINT_unpredictable`, when a branch is acceptable; compilers are
+  better at optimizing it.
+
+  @tparam T A trivially-copyable type of size 1, 2, 4, or 8, e.g., an
+  integer, floating-point, enumeration, or pointer type
+*/
+template <typename T>
+LBAL_FUNC_FORCE_INLINE T
+select(bool in_condition, T in_true, T in_false) noexcept {
+  static_assert(std::is_trivially_copyable_v<T>,
+      "lbal::select requires a trivially-copyable type");
+
+  using bits_type = typename details::select_bits<sizeof(T)>::type;
+
+  bits_type true_bits;
+  bits_type false_bits;
+
+  std::memcpy(&true_bits, &in_true, sizeof(T));
+  std::memcpy(&false_bits, &in_false, sizeof(T));
+
+  bits_type const result_bits = static_cast<bits_type>(false_bits
+      ^ ((true_bits ^ false_bits)
+          & details::select_mask<bits_type>(in_condition)));
+
+  std::memcpy(&in_true, &result_bits, sizeof(T));
+
+  return in_true;
+}
+
+#if LBAL_TARGET_COMPILER_MSVC
+namespace details {
+
+//	Storing an address here makes the object it points to escape, since the
+//	compiler can’t prove that no one reads it back.
+inline char const volatile * volatile optimization_sink{nullptr};
+
+}  //	namespace details
+#endif
+
+/**
+  @brief Force a value to be computed and treated as observed
+
+  @details This is intended for microbenchmarks: the compiler must
+  materialize `in_value`, in a register or in memory, as though something
+  reads it, so neither it nor the work that produced it can be discarded or
+  hoisted out of the measured region. It emits no instructions of its own.
+
+  @remarks On GCC and Clang, this is an empty `asm` statement that takes
+  the value as an input operand and also clobbers memory. On MSVC, which has
+  no inline assembly on every target, the value’s address escapes through a
+  `volatile` sink, followed by `_ReadWriteBarrier`.
+*/
+template <typename T>
+LBAL_FUNC_FORCE_INLINE void
+do_not_optimize(T const & in_value) noexcept {
+#if LBAL_TARGET_COMPILER_CLANG
+  __asm__ __volatile__("" : : "r,m"(in_value) : "memory");
+#elif LBAL_TARGET_COMPILER_GCC
+  //	SEEME - bitweeder
+  //	GCC may choose the register alternative for types that don’t fit in one,
+  //	so it only gets the memory constraint here.
+  __asm__ __volatile__("" : : "m"(in_value) : "memory");
+#elif LBAL_TARGET_COMPILER_MSVC
+  details::optimization_sink =
+      &reinterpret_cast<char const volatile &>(in_value);
+  _ReadWriteBarrier();
+#else
+  auto const volatile * const sink{&in_value};
+
+  static_cast<void>(sink);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+  @brief Force a value to be computed, and treat it as possibly modified
+
+  @details As the `const` overload, but the compiler must also assume that
+  `io_value` was changed, so later computations can’t be folded using what
+  it knew about its prior contents, e.g., a loop-invariant input.
+*/
+template <typename T>
+LBAL_FUNC_FORCE_INLINE void
+do_not_optimize(T & io_value) noexcept {
+#if LBAL_TARGET_COMPILER_CLANG
+  __asm__ __volatile__("" : "+r,m"(io_value) : : "memory");
+#elif LBAL_TARGET_COMPILER_GCC
+  if constexpr (std::is_trivially_copyable_v<T>
+      && (sizeof(T) <= sizeof(void *))) {
+    __asm__ __volatile__("" : "+m,r"(io_value) : : "memory");
+  } else {
+    __asm__ __volatile__("" : "+m"(io_value) : : "memory");
+  }
+#elif LBAL_TARGET_COMPILER_MSVC
+  details::optimization_sink =
+      &reinterpret_cast<char const volatile &>(io_value);
+  _ReadWriteBarrier();
+#else
+  auto volatile * const sink{&io_value};
+
+  static_cast<void>(sink);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+  @brief Force all pending writes to memory to be treated as observed
+
+  @details This is a compiler-only barrier: it emits no fence instruction,
+  but the compiler may neither discard stores made before it nor carry
+  values it loaded across it. Pair it with `do_not_optimize` on a buffer’s
+  address to keep the writes to that buffer in a benchmark loop.
+*/
+LBAL_FUNC_FORCE_INLINE void
+clobber_memory() noexcept {
+#if LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC
+  __asm__ __volatile__("" : : : "memory");
+#elif LBAL_TARGET_COMPILER_MSVC
+  _ReadWriteBarrier();
+#else
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+namespace details {
+
+//	The widest block that `memcpy_streaming` moves with non-temporal stores,
+//	or `0` if we don’t know how to emit them for this target.
+inline constexpr std::size_t stream_block_bytes{
+#if LBAL_TARGET_VEC_AVX512F
+    64
+#elif LBAL_TARGET_VEC_AVX
+    32
+#elif LBAL_TARGET_VEC_SSE2
+    16
+#elif LBAL_TARGET_CPU_ARM_64                                                   \
+    && (LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC)
+    16
+#else
+    0
+#endif
+};
+
+template <std::size_t Size>
+LBAL_FUNC_FORCE_INLINE void
+stream_store_bytes(void * o_dest, void const * in_src) noexcept {
+#if LBAL_TARGET_VEC_SSE2
+  if constexpr (4 == Size) {
+    int value;
+
+    std::memcpy(&value, in_src, sizeof(value));
+    _mm_stream_si32(static_cast<int *>(o_dest), value);
+  #if LBAL_TARGET_CPU_X86_64
+  } else if constexpr (8 == Size) {
+    long long value;
+
+    std::memcpy(&value, in_src, sizeof(value));
+    _mm_stream_si64(static_cast<long long *>(o_dest), value);
+  #endif
+  } else if constexpr (16 == Size) {
+    _mm_stream_si128(
+        LBAL_HINT_assume_aligned(static_cast<__m128i *>(o_dest), 16),
+        _mm_loadu_si128(static_cast<__m128i const *>(in_src)));
+  #if LBAL_TARGET_VEC_AVX
+  } else if constexpr (32 == Size) {
+    _mm256_stream_si256(
+        LBAL_HINT_assume_aligned(static_cast<__m256i *>(o_dest), 32),
+        _mm256_loadu_si256(static_cast<__m256i const *>(in_src)));
+  #endif
+  #if LBAL_TARGET_VEC_AVX512F
+  } else if constexpr (64 == Size) {
+    _mm512_stream_si512(
+        LBAL_HINT_assume_aligned(static_cast<__m512i *>(o_dest), 64),
+        _mm512_loadu_si512(in_src));
+  #endif
+  } else if constexpr ((Size > 16) && (0 == Size % 32)) {
+    stream_store_bytes<Size / 2>(o_dest, in_src);
+    stream_store_bytes<Size / 2>(static_cast<char *>(o_dest) + Size / 2,
+        static_cast<char const *>(in_src) + Size / 2);
+  } else {
+    std::memcpy(o_dest, in_src, Size);
+  }
+#elif LBAL_TARGET_CPU_ARM_64                                                   \
+    && (LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC)
+  //	`stnp` only stores pairs of registers, so there is no form narrower
+  //	than 8 bytes.
+  if constexpr (8 == Size) {
+    std::uint32_t halves[2];
+
+    std::memcpy(halves, in_src, sizeof(halves));
+    __asm__ __volatile__("stnp %w1, %w2, [%0]"
+                         :
+                         : "r"(o_dest), "r"(halves[0]), "r"(halves[1])
+                         : "memory");
+  } else if constexpr (16 == Size) {
+    std::uint64_t halves[2];
+
+    std::memcpy(halves, in_src, sizeof(halves));
+    __asm__ __volatile__("stnp %x1, %x2, [%0]"
+                         :
+                         : "r"(o_dest), "r"(halves[0]), "r"(halves[1])
+                         : "memory");
+  } else if constexpr ((Size > 16) && (0 == Size % 32)) {
+    stream_store_bytes<Size / 2>(o_dest, in_src);
+    stream_store_bytes<Size / 2>(static_cast<char *>(o_dest) + Size / 2,
+        static_cast<char const *>(in_src) + Size / 2);
+  } else {
+    std::memcpy(o_dest, in_src, Size);
+  }
+#elif LBAL_TARGET_COMPILER_CLANG
+  if constexpr ((1 == Size) || (2 == Size) || (4 == Size) || (8 == Size)) {
+    typename select_bits<Size>::type value;
+
+    std::memcpy(&value, in_src, Size);
+    __builtin_nontemporal_store(
+        value, static_cast<typename select_bits<Size>::type *>(o_dest));
+  } else {
+    std::memcpy(o_dest, in_src, Size);
+  }
+#else
+  std::memcpy(o_dest, in_src, Size);
+#endif
+}
+
+template <std::size_t Size>
+LBAL_FUNC_FORCE_INLINE void
+stream_load_bytes(void * o_dest, void const * in_src) noexcept {
+#if LBAL_TARGET_VEC_SSE41
+  //	SEEME - bitweeder
+  //	Some older headers take a pointer to non-`const` here.
+  if constexpr (16 == Size) {
+    _mm_storeu_si128(static_cast<__m128i *>(o_dest),
+        _mm_stream_load_si128(const_cast<__m128i *>(LBAL_HINT_assume_aligned(
+            static_cast<__m128i const *>(in_src), 16))));
+  #if LBAL_TARGET_VEC_AVX2
+  } else if constexpr (32 == Size) {
+    _mm256_storeu_si256(static_cast<__m256i *>(o_dest),
+        _mm256_stream_load_si256(LBAL_HINT_assume_aligned(
+            static_cast<__m256i const *>(in_src), 32)));
+  #endif
+  } else if constexpr ((Size > 16) && (0 == Size % 32)) {
+    stream_load_bytes<Size / 2>(o_dest, in_src);
+    stream_load_bytes<Size / 2>(static_cast<char *>(o_dest) + Size / 2,
+        static_cast<char const *>(in_src) + Size / 2);
+  } else {
+    std::memcpy(o_dest, in_src, Size);
+  }
+#elif LBAL_TARGET_CPU_ARM_64                                                   \
+    && (LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC)
+  if constexpr (8 == Size) {
+    std::uint32_t halves[2];
+
+    __asm__ __volatile__("ldnp %w0, %w1, [%2]"
+                         : "=r"(halves[0]), "=r"(halves[1])
+                         : "r"(in_src)
+                         : "memory");
+    std::memcpy(o_dest, halves, sizeof(halves));
+  } else if constexpr (16 == Size) {
+    std::uint64_t halves[2];
+
+    __asm__ __volatile__("ldnp %x0, %x1, [%2]"
+                         : "=r"(halves[0]), "=r"(halves[1])
+                         : "r"(in_src)
+                         : "memory");
+    std::memcpy(o_dest, halves, sizeof(halves));
+  } else if constexpr ((Size > 16) && (0 == Size % 32)) {
+    stream_load_bytes<Size / 2>(o_dest, in_src);
+    stream_load_bytes<Size / 2>(static_cast<char *>(o_dest) + Size / 2,
+        static_cast<char const *>(in_src) + Size / 2);
+  } else {
+    std::memcpy(o_dest, in_src, Size);
+  }
+#elif LBAL_TARGET_COMPILER_CLANG
+  if constexpr ((1 == Size) || (2 == Size) || (4 == Size) || (8 == Size)) {
+    auto const value = __builtin_nontemporal_load(
+        static_cast<typename select_bits<Size>::type const *>(in_src));
+
+    std::memcpy(o_dest, &value, Size);
+  } else {
+    std::memcpy(o_dest, in_src, Size);
+  }
+#else
+  std::memcpy(o_dest, in_src, Size);
+#endif
+}
+
+}  //	namespace details
+
+/**
+  @brief Order non-temporal stores before any store that follows
+
+  @details Non-temporal stores bypass the normal cache-coherence ordering on
+  x86, so they must be fenced before anything that publishes their results
+  to another thread, e.g., a release store to a flag. This is `sfence` on
+  x86, `dmb ishst` on ARM64, and a compiler barrier elsewhere.
+*/
+LBAL_FUNC_FORCE_INLINE void
+stream_fence() noexcept {
+#if LBAL_TARGET_VEC_SSE2
+  _mm_sfence();
+#elif LBAL_TARGET_CPU_ARM_64                                                   \
+    && (LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC)
+  __asm__ __volatile__("dmb ishst" : : : "memory");
+#else
+  clobber_memory();
+#endif
+}
+
+/**
+  @brief Store a value without pulling its destination into the cache
+
+  @details This writes `in_value` to `o_dest` with a non-temporal store, so
+  that writing a large buffer that won’t be read again soon doesn’t evict
+  everyone else’s working set. Values of 16, 32, or 64 bytes use a single
+  vector store on x86 when the target supports one, and 8- and 16-byte
+  values use `stnp` on ARM64; Clang uses `__builtin_nontemporal_store` for
+  scalars on other targets. Anything else is an ordinary store.
+
+  @remarks Call `stream_fence` before publishing the stored data to another
+  thread.
+
+  @pre On x86, `o_dest` must be aligned to `sizeof(T)` when that is 16, 32,
+  or 64; this is checked when `LBAL_CONFIG_check_assumptions` is set.
+
+  @tparam T A trivially-copyable type
+*/
+template <typename T>
+LBAL_FUNC_FORCE_INLINE void
+stream_store(T * o_dest, T const & in_value) noexcept {
+  static_assert(std::is_trivially_copyable_v<T>,
+      "lbal::stream_store requires a trivially-copyable type");
+
+  details::stream_store_bytes<sizeof(T)>(o_dest, &in_value);
+}
+
+/**
+  @brief Load a value while minimizing its cache footprint
+
+  @details This is the counterpart to `stream_store`, using `movntdqa` for
+  16- and 32-byte values on x86 with SSE4.1 or AVX2, and `ldnp` for 8- and
+  16-byte values on ARM64. Otherwise, it is an ordinary load.
+
+  @remarks On x86, `movntdqa` only avoids the cache for write-combining
+  memory, e.g., a mapped device buffer; on ordinary memory it behaves as a
+  normal load, so prefer `LBAL_HINT_prefetch` with a non-temporal locality
+  hint for streaming reads there.
+
+  @pre On x86, `in_src` must be aligned to `sizeof(T)` when that is 16 or
+  32; this is checked when `LBAL_CONFIG_check_assumptions` is set.
+
+  @tparam T A trivially-copyable, trivially default-constructible type
+*/
+template <typename T>
+LBAL_FUNC_FORCE_INLINE T
+stream_load(T const * in_src) noexcept {
+  static_assert(std::is_trivially_copyable_v<T>
+          && std::is_trivially_default_constructible_v<T>,
+      "lbal::stream_load requires a trivial type");
+
+  T result;
+
+  details::stream_load_bytes<sizeof(T)>(&result, in_src);
+
+  return result;
+}
+
+/**
+  @brief Copy a large buffer without displacing the cache
+
+  @details This behaves as `std::memcpy`, but writes the bulk of the
+  destination with non-temporal stores of the widest available vector
+  width, after aligning the destination with ordinary stores, and ends with
+  `stream_fence`, so the copy is complete and ordered when this returns. It
+  is meant for buffers much larger than the last-level cache, e.g.,
+  snapshots, where ordinary stores would evict the working set of every
+  other thread sharing that cache. Copies smaller than a couple of vector
+  blocks, and all copies on targets without non-temporal stores, simply
+  call `std::memcpy`.
+
+  @remarks The source is read with ordinary loads; it is usually already
+  cold, and the hardware prefetchers handle a sequential read well.
+
+  @return `o_dest`
+*/
+inline void *
+memcpy_streaming(
+    void * o_dest,
+    void const * in_src,
+    std::size_t in_size
+) noexcept {
+  constexpr std::size_t block{details::stream_block_bytes};
+
+  if constexpr (0 == block) {
+    return std::memcpy(o_dest, in_src, in_size);
+  } else {
+    if (in_size < 2 * block) return std::memcpy(o_dest, in_src, in_size);
+
+    auto * dest = static_cast<unsigned char *>(o_dest);
+    auto const * src = static_cast<unsigned char const *>(in_src);
+
+    if (auto const offset =
+            reinterpret_cast<std::uintptr_t>(dest) & (block - 1)) {
+      auto const head = block - offset;
+
+      std::memcpy(dest, src, head);
+
+      dest += head;
+      src += head;
+      in_size -= head;
+    }
+
+    for (; in_size >= block; in_size -= block) {
+      details::stream_store_bytes<block>(dest, src);
+
+      dest += block;
+      src += block;
+    }
+
+    std::memcpy(dest, src, in_size);
+    stream_fence();
+
+    return o_dest;
+  }
+}
+
+LBAL_end_v_namespace
+
+///	@}	lbal_builtins
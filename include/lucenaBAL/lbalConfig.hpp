@@ -283,6 +283,31 @@
   #define LBAL_CONFIG_treat_uncertainty_as_failure 0
 #endif
 
+/**
+  @def LBAL_CONFIG_check_assumptions
+
+  @brief Client setting to turn optimizer assumptions into runtime checks
+
+  @details When this is `1`, `LBAL_HINT_assume` evaluates its expression and
+  traps, reporting the file and line, if the expression is false, rather
+  than passing it to the optimizer as a fact. This catches violated
+  assumptions during testing, where they would otherwise be silent undefined
+  behavior. By default, this follows `LBAL_CONFIG_debug`.
+
+  @remarks When enabled, the metaheader additionally includes `<cstdio>` and
+  `<cstdlib>` in order to report failures.
+
+  @remarks This can be set per-tranlation unit, globally, or any combination
+  in-between.
+*/
+#ifndef LBAL_CONFIG_check_assumptions
+  #if defined(LBAL_CONFIG_debug) && LBAL_CONFIG_debug
+    #define LBAL_CONFIG_check_assumptions 1
+  #else
+    #define LBAL_CONFIG_check_assumptions 0
+  #endif
+#endif
+
 ///	@}	Settings
 
 /**
@@ -509,7 +534,10 @@ LBAL_begin_v_namespace LBAL_end_v_namespace
       shipping code.
 
       SEEME - bitweeder
-      This is unused as of lucenaBAL 2.
+      As of lucenaBAL 2, this turns LBAL_HINT_unreachable into a trap that
+      reports the file and line, and serves as the default for
+      LBAL_CONFIG_check_assumptions. When set, the metaheader includes
+      <cstdio> and <cstdlib> in order to report failures.
     */
     // #define LBAL_CONFIG_debug 1
 
@@ -407,10 +407,10 @@
   @details Multiple conditionals may be true, but some are mutually
   exclusive.
 
-  @remarks (APIME) There is no corresponding test for AVX-512, as it’s not
-  a monolithic instruction set, and we don’t have the operational experience
-  needed to evaluate a meaningful breakdown beyond just mirroring any
-  predfined macros the compiler may happen to have.
+  @remarks (APIME) AVX-512 is not a monolithic instruction set; we only track
+  the foundation subset (`LBAL_TARGET_VEC_AVX512F`), as we don’t have the
+  operational experience needed to evaluate a meaningful breakdown beyond just
+  mirroring any predfined macros the compiler may happen to have.
 
   @remarks (SEEME - bitweeder) We don’t currently independently check for
   SSE-Math and similar instruction splits; this may be a defect.
@@ -478,8 +478,160 @@
   #define LBAL_TARGET_VEC_AVX2 0
 #endif
 
+/**
+  @def LBAL_TARGET_VEC_AVX512F
+  Intel AVX-512 Foundation SIMD instruction set.
+*/
+#ifndef LBAL_TARGET_VEC_AVX512F
+  #define LBAL_TARGET_VEC_AVX512F 0
+#endif
+
+/**
+  @def LBAL_TARGET_VEC_NEON
+  ARM Advanced SIMD (NEON) instruction set.
+*/
+#ifndef LBAL_TARGET_VEC_NEON
+  #define LBAL_TARGET_VEC_NEON 0
+#endif
+
+/**
+  @def LBAL_TARGET_VEC_SVE
+  ARM Scalable Vector Extension instruction set.
+*/
+#ifndef LBAL_TARGET_VEC_SVE
+  #define LBAL_TARGET_VEC_SVE 0
+#endif
+
+/**
+  @def LBAL_TARGET_VEC_NATIVE_BYTES
+
+  @brief Width in bytes of the widest vector register the compiler has been
+  allowed to target
+
+  @details This is `64` for AVX-512, `32` for AVX/AVX2, and `16` for SSE and
+  NEON. For SVE, this is the fixed vector length if one was specified at
+  compile time (e.g., via `-msve-vector-bits`), and the architectural minimum
+  of `16` otherwise. If no vector instruction set is available, this is `0`.
+
+  Use this to size blocked loops, probe groups, and the like. For a per-type
+  lane count, see `LBAL_::native_simd_lanes` in `<lucenaBAL/lbalBuiltins.hpp>`.
+
+  @remarks (SEEME - bitweeder) AVX without AVX2 only offers 256-bit floating
+  point operations; integer operations remain 128 bits wide. Similarly, some
+  AVX-512 implementations downclock on heavy use of 512-bit registers, and
+  compilers may be configured to prefer 256-bit vectors regardless. This token
+  reports what is architecturally available, not what is most profitable.
+*/
+#ifndef LBAL_TARGET_VEC_NATIVE_BYTES
+  #define LBAL_TARGET_VEC_NATIVE_BYTES 0
+#endif
+
+/**
+  @def LBAL_TARGET_VEC_REGISTER_COUNT
+
+  @brief Number of architectural vector registers of width
+  `LBAL_TARGET_VEC_NATIVE_BYTES` available to the compiler
+
+  @details For example, this is `16` for SSE and AVX on x86-64, `32` for
+  AVX-512 on x86-64, and `32` for NEON and SVE on AArch64. 32-bit x86 only
+  ever exposes `8`. If no vector instruction set is available, this is `0`.
+
+  This is useful for deciding how many independent accumulators a kernel can
+  keep live before it starts spilling.
+*/
+#ifndef LBAL_TARGET_VEC_REGISTER_COUNT
+  #define LBAL_TARGET_VEC_REGISTER_COUNT 0
+#endif
+
 ///	@}	LBAL_TARGET_VEC
 
+/**
+  @name LBAL_TARGET_CACHE
+
+  @brief Compile-time estimates of the target’s cache geometry
+
+  @details These are reasonable defaults for the target CPU family and
+  platform, suitable for `alignas`, padding, and compile-time tiling. Unlike
+  most tokens, these may be overridden by the client, e.g., from the build
+  system when targeting a specific microarchitecture. When the actual values
+  matter, query them at runtime with `LBAL_::cache_info()` from
+  `<lucenaBAL/lbalPlatformInfo.hpp>`.
+
+  @remarks (SEEME - bitweeder) These exist in part because
+  `LBAL_LIBCPP17_HARDWARE_INTERFERENCE_SIZE` is unavailable with libc++,
+  which—reasonably—refuses to bake a value that may differ between the build
+  and run machines into its ABI. Since these tokens are not part of any
+  Standard Library ABI, the same concern does not apply; just be sure to use
+  the same values across all binaries that share data structures.
+
+  @{
+*/
+
+/**
+  @def LBAL_TARGET_CACHE_LINE_SIZE
+
+  @brief Size in bytes of an L1 data cache line on the target
+
+  @details This is `64` for x86 and most ARM implementations, and `128` for
+  Apple Silicon. Use this as the unit of spatial locality, e.g., for
+  prefetch strides or for keeping objects that are used together on the same
+  line (cf., `std::hardware_constructive_interference_size`).
+*/
+#ifndef LBAL_TARGET_CACHE_LINE_SIZE
+  #define LBAL_TARGET_CACHE_LINE_SIZE 64
+#endif
+
+/**
+  @def LBAL_TARGET_CACHE_INTERFERENCE_SIZE
+
+  @brief Minimum distance in bytes between two objects needed to avoid false
+  sharing on the target
+
+  @details This is typically twice `LBAL_TARGET_CACHE_LINE_SIZE` on targets
+  whose prefetchers fetch adjacent line pairs, e.g., `128` on x86 and
+  Neoverse-class AArch64 cores. Use it to pad per-thread or per-core data
+  (cf., `std::hardware_destructive_interference_size`).
+*/
+#ifndef LBAL_TARGET_CACHE_INTERFERENCE_SIZE
+  #define LBAL_TARGET_CACHE_INTERFERENCE_SIZE 128
+#endif
+
+///	@}	LBAL_TARGET_CACHE
+
+/**
+  @name LBAL_TARGET_PAGE
+
+  @brief Compile-time estimate of the target’s virtual memory page size
+
+  @details As with `LBAL_TARGET_CACHE`, this is a default for the target CPU
+  family and platform that the client may override. When the actual value
+  matters, e.g., for `mmap` or `madvise`, query it at runtime with
+  `LBAL_::page_size()` from `<lucenaBAL/lbalPlatformInfo.hpp>`.
+
+  @{
+*/
+
+/**
+  @def LBAL_TARGET_PAGE_SIZE_DEFAULT
+
+  @brief Expected size in bytes of a base (non-huge) page on the target
+
+  @details This is `4096` for x86 and for most ARM targets, and `16384` for
+  Apple Silicon and IA-64.
+
+  @remarks (SEEME - bitweeder) AArch64 Linux kernels are commonly configured
+  for 4 KiB, 16 KiB, or 64 KiB pages, and the compiler environment offers no
+  way to tell which. Clients shipping to a known distribution should
+  override this from the build system; everyone else should treat it as a
+  lower bound, and rely on `LBAL_::page_size()` for anything that must match
+  the kernel.
+*/
+#ifndef LBAL_TARGET_PAGE_SIZE_DEFAULT
+  #define LBAL_TARGET_PAGE_SIZE_DEFAULT 4096
+#endif
+
+///	@}	LBAL_TARGET_PAGE
+
 /**
   @name LBAL_TARGET_OS
 
@@ -853,6 +1005,40 @@
   #define LBAL_FEATURE_UTF16_FILE_SYSTEM 0
 #endif
 
+/**
+  @def LBAL_FEATURE_MUSTTAIL
+
+  @brief The compiler can guarantee tail calls.
+
+  @details If this is set, `LBAL_MUSTTAIL` is available and turns a
+  `return` of a call into a jump, or fails to compile. Code built around
+  tail-call-threaded dispatch, e.g., interpreters and table-driven parsers,
+  should test this and fall back to a loop when it isn’t set, since without
+  the guarantee, such code can overflow the stack.
+*/
+#ifndef LBAL_FEATURE_MUSTTAIL
+  #define LBAL_FEATURE_MUSTTAIL 0
+#endif
+
+/**
+  @def LBAL_MUSTTAIL
+
+  @brief Require that a call be compiled as a tail call.
+
+  @details This is placed before a `return` statement whose operand is a
+  function call, e.g., `LBAL_MUSTTAIL return handlers[op](state, pc + 1);`,
+  and resolves to `[[clang::musttail]]` or GCC’s `musttail` attribute. The
+  compiler rejects the call if it can’t be made without growing the stack;
+  in particular, the caller and callee must generally have matching
+  signatures, and no object with a non-trivial destructor may be live.
+
+  Where `LBAL_FEATURE_MUSTTAIL` is not set, this resolves to nothing, leaving
+  an ordinary call that the optimizer may or may not turn into a jump.
+*/
+#ifndef LBAL_MUSTTAIL
+  #define LBAL_MUSTTAIL
+#endif
+
 ///	@}	LBAL_FEATURE
 
 ///	@}	lbal_platform
@@ -10472,6 +10658,127 @@
   #define LBAL_CPP_WARNING(LBAL_CPP_WARNING_message)
 #endif
 
+/**
+  @name LBAL_LOOP
+
+  @brief Loop optimization pragmas
+
+  @details Each of these expands to the compiler’s own pragma, and is placed
+  on the line immediately before a `for`, `while`, or `do` loop; several may
+  be stacked ahead of the same loop. Where a compiler has no equivalent, the
+  macro expands to nothing, so these are strictly requests.
+
+  @remarks Arguments must be integer literals, as they are pasted into the
+  pragma text unevaluated.
+
+  @{
+*/
+
+/**
+  @def LBAL_LOOP_UNROLL(LBAL_count_)
+  Unroll the following loop `LBAL_count_` times; this is `#pragma GCC unroll`
+  on GCC and `#pragma clang loop unroll_count` on clang
+*/
+#ifndef LBAL_LOOP_UNROLL
+  #define LBAL_LOOP_UNROLL(LBAL_count_)
+#endif
+
+/**
+  @def LBAL_LOOP_NO_UNROLL
+  Don’t unroll the following loop, e.g., to keep a cold loop compact
+*/
+#ifndef LBAL_LOOP_NO_UNROLL
+  #define LBAL_LOOP_NO_UNROLL
+#endif
+
+/**
+  @def LBAL_LOOP_VECTORIZE
+  Vectorize the following loop, even where the cost model would decline;
+  this is only supported by clang
+*/
+#ifndef LBAL_LOOP_VECTORIZE
+  #define LBAL_LOOP_VECTORIZE
+#endif
+
+/**
+  @def LBAL_LOOP_IVDEP
+  Ignore assumed loop-carried memory dependences in the following loop when
+  vectorizing; this is `#pragma GCC ivdep` on GCC, `#pragma loop(ivdep)` on
+  MSVC, and `#pragma clang loop vectorize(assume_safety)` on clang. If the
+  loop does carry such a dependence, results are undefined.
+*/
+#ifndef LBAL_LOOP_IVDEP
+  #define LBAL_LOOP_IVDEP
+#endif
+
+/**
+  @def LBAL_LOOP_VECTORIZE_WIDTH(LBAL_width_)
+  Vectorize the following loop using `LBAL_width_` lanes; this is only
+  supported by clang
+*/
+#ifndef LBAL_LOOP_VECTORIZE_WIDTH
+  #define LBAL_LOOP_VECTORIZE_WIDTH(LBAL_width_)
+#endif
+
+///	@}	LBAL_LOOP
+
+/**
+  @name LBAL_BUILD
+
+  @brief Code generation options in effect for this translation unit
+
+  @details These reflect how the code is being compiled, rather than what
+  the compiler supports, and mostly matter for code built into shared
+  libraries, where each call to or access of an interposable symbol goes
+  through the PLT or GOT.
+
+  @{
+*/
+
+/**
+  @def LBAL_BUILD_PIC
+  This is `1` if the code is being compiled as position-independent, as for
+  a shared library or a position-independent executable, per `__PIC__` and
+  `__PIE__`. This is always `0` for Windows, whose images are relocated at
+  load time instead.
+*/
+#ifndef LBAL_BUILD_PIC
+  #define LBAL_BUILD_PIC 0
+#endif
+
+/**
+  @def LBAL_BUILD_PIE
+  This is `1` if the code is being compiled for a position-independent
+  executable, rather than a shared library; this implies `LBAL_BUILD_PIC`.
+  Such code can’t be loaded as a plugin, and may use the cheaper
+  executable-only TLS models.
+*/
+#ifndef LBAL_BUILD_PIE
+  #define LBAL_BUILD_PIE 0
+#endif
+
+/**
+  @def LBAL_BUILD_NO_SEMANTIC_INTERPOSITION
+
+  @brief Calls between functions in the same library bind locally.
+
+  @details On ELF platforms, any function with default visibility in a
+  shared library may be replaced at load time, e.g., by `LD_PRELOAD`, so by
+  default the compiler neither inlines it nor calls it directly from within
+  the library. Building with `-fno-semantic-interposition` lifts those
+  restrictions; this token records that the build did so, since the flag is
+  not visible to the preprocessor.
+
+  @remarks This is never inferred; a client that passes the flag should
+  also define this as `1`, e.g., from the same CMake target. Apple and
+  Windows platforms bind calls within an image directly regardless.
+*/
+#ifndef LBAL_BUILD_NO_SEMANTIC_INTERPOSITION
+  #define LBAL_BUILD_NO_SEMANTIC_INTERPOSITION 0
+#endif
+
+///	@}	LBAL_BUILD
+
 ///	@}	lbal_compiler_control
 
 /**
@@ -10509,8 +10816,9 @@
 
   @details `LBAL_expr_` must resolve to a boolean.
 
-  This is roughly equivalent to the C++20 `[[likely]]` attribute, and may
-  resolve to it, if it is available.
+  This is roughly equivalent to the C++20 `[[likely]]` attribute, but applies
+  to a condition rather than to a statement; see `LBAL_LIKELY` for the
+  statement form.
 */
 #ifndef LBAL_HINT_likely
   #define LBAL_HINT_likely(LBAL_expr_) LBAL_expr_
@@ -10523,15 +10831,319 @@
 
   @details `LBAL_expr_` must resolve to a boolean.
 
-  This is roughly equivalent to the C++20 `[[unlikely]]` attribute, and may
-  resolve to it, if it is available.
+  This is roughly equivalent to the C++20 `[[unlikely]]` attribute, but applies
+  to a condition rather than to a statement; see `LBAL_UNLIKELY` for the
+  statement form.
 */
 #ifndef LBAL_HINT_unlikely
   #define LBAL_HINT_unlikely(LBAL_expr_) LBAL_expr_
 #endif
 
+/**
+  @def LBAL_HINT_expect_probability(LBAL_expr_, LBAL_value_, LBAL_probability_)
+
+  @brief Branch prediction hinting with an explicit probability
+
+  @details This evaluates to `LBAL_expr_`, while hinting that it equals
+  `LBAL_value_` with probability `LBAL_probability_`, which must be a
+  constant expression in the range `[0.0, 1.0]`. This lets calibrated
+  branch weights, e.g., from profiling, inform block layout, e.g.:
+
+  @code
+    if (LBAL_HINT_expect_probability(cache.hit(key), true, 0.9)) {
+      ...
+    }
+  @endcode
+
+  Where the compiler has no notion of probability, this degrades to a
+  plain `__builtin_expect` on `LBAL_value_`, and then to `LBAL_expr_`
+  itself.
+*/
+#ifndef LBAL_HINT_expect_probability
+  #define LBAL_HINT_expect_probability(                                        \
+      LBAL_expr_, LBAL_value_, LBAL_probability_)                              \
+    LBAL_expr_
+#endif
+
+/**
+  @def LBAL_HINT_unpredictable(LBAL_expr_)
+
+  @brief Branch prediction hinting that a condition follows no useful
+  pattern
+
+  @details `LBAL_expr_` must resolve to a boolean. This marks data-dependent
+  conditions, e.g., comparisons in a sorting network or hash-bucket
+  selection, for which a misprediction costs more than evaluating both arms,
+  encouraging the compiler to emit a conditional move rather than a branch.
+  It is only a hint; where a branchless result is required, use
+  `lbal::select` from `<lucenaBAL/lbalBuiltins.hpp>`.
+*/
+#ifndef LBAL_HINT_unpredictable
+  #define LBAL_HINT_unpredictable(LBAL_expr_) LBAL_expr_
+#endif
+
+/**
+  @def LBAL_LIKELY
+
+  @brief Statement-level hint that a path of execution is likely
+
+  @details This resolves to the C++20 `[[likely]]` attribute where it is
+  available, and to nothing otherwise. Unlike `LBAL_HINT_likely`, it is
+  placed in front of a statement or label rather than wrapped around a
+  condition, which makes it usable with `switch` cases and on compilers,
+  such as MSVC, that have no expression-level hint, e.g.:
+
+  @code
+    switch (token.kind) {
+      LBAL_LIKELY case kind::identifier:
+        ...
+    }
+
+    if (n > threshold) LBAL_LIKELY {
+      ...
+    }
+  @endcode
+*/
+#ifndef LBAL_LIKELY
+  #define LBAL_LIKELY
+#endif
+
+/**
+  @def LBAL_UNLIKELY
+
+  @brief Statement-level hint that a path of execution is unlikely
+
+  @details This resolves to the C++20 `[[unlikely]]` attribute where it is
+  available, and to nothing otherwise; see `LBAL_LIKELY`.
+*/
+#ifndef LBAL_UNLIKELY
+  #define LBAL_UNLIKELY
+#endif
+
+/**
+  @def LBAL_HINT_assume(LBAL_expr_)
+
+  @brief Inform the optimizer that an expression is always true at this
+  point
+
+  @details `LBAL_expr_` must resolve to a boolean, and should be free of side
+  effects, as it may or may not be evaluated. This is used as a statement,
+  e.g., `LBAL_HINT_assume(n % 8 == 0);`, and lets the optimizer discard
+  range checks, remainder loops, and the like.
+
+  This resolves to the C++23 `[[assume]]` attribute where available, and
+  otherwise to `__builtin_assume` (Clang), `__assume` (MSVC), or a branch to
+  `__builtin_unreachable` (GCC). Where none of these is available, it has no
+  effect.
+
+  @remarks (SEEME - bitweeder) If the expression is ever false, behavior is
+  undefined. Setting `LBAL_CONFIG_check_assumptions`, which is the default in
+  debug builds, turns every assumption into a checked assertion that reports
+  the file and line before aborting.
+*/
+#ifndef LBAL_HINT_assume
+  #define LBAL_HINT_assume(LBAL_expr_) static_cast<void>(0)
+#endif
+
+/**
+  @def LBAL_HINT_unreachable()
+
+  @brief Inform the optimizer that control can never reach this point
+
+  @details This is used as a statement, typically in the `default` case of an
+  exhaustive `switch` or after a loop that always returns, and lets the
+  optimizer drop the corresponding bounds checks and fall-through paths.
+
+  This resolves to `__builtin_unreachable()` (Clang and GCC) or `__assume(0)`
+  (MSVC), and otherwise to the C++23 `std::unreachable()` if
+  `LBAL_LIBCPP23_UNREACHABLE` is set, in which case the client must include
+  `<utility>`. Where none of these is available, it has no effect.
+
+  @remarks (SEEME - bitweeder) Reaching this is undefined behavior. When
+  `LBAL_CONFIG_debug` is set, it instead reports the file and line and
+  aborts.
+*/
+#ifndef LBAL_HINT_unreachable
+  #define LBAL_HINT_unreachable() static_cast<void>(0)
+#endif
+
+/**
+  @def LBAL_HINT_assume_aligned(LBAL_ptr_, LBAL_alignment_)
+
+  @brief Inform the optimizer that a pointer is suitably aligned
+
+  @details This evaluates to `LBAL_ptr_`, which is evaluated exactly once,
+  while promising that it is aligned to at least `LBAL_alignment_` bytes,
+  which must be a constant power of two. Accesses through the result, e.g.,
+
+  @code
+    auto * const lanes = LBAL_HINT_assume_aligned(arena.floats(), 64);
+  @endcode
+
+  can then use aligned loads and stores, without runtime checks or loop
+  peeling. If the promise is broken, the behavior is undefined.
+
+  This resolves to `__builtin_assume_aligned` or an equivalent `__assume`
+  where available, and otherwise to `std::assume_aligned` if the Standard
+  Library provides it, in which case the client is responsible for
+  including `<memory>`. When `LBAL_CONFIG_check_assumptions` is set, the
+  alignment is verified at runtime instead, and a violation aborts with a
+  diagnostic; see `LBAL_HINT_assume`.
+*/
+#ifndef LBAL_HINT_assume_aligned
+  #define LBAL_HINT_assume_aligned(LBAL_ptr_, LBAL_alignment_) (LBAL_ptr_)
+#endif
+
+/**
+  @def LBAL_HINT_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)
+
+  @brief Ask the CPU to start loading the cache line containing an address
+
+  @details `LBAL_addr_` is any pointer; it need not be valid, as prefetches
+  never fault. `LBAL_rw_` is `0` to prepare for a read or `1` to prepare for
+  a write, and `LBAL_locality_` ranges from `0` (no temporal locality; evict
+  soon after use) to `3` (keep in all levels of cache), exactly as with
+  `__builtin_prefetch`. Both must be integer constant expressions.
+
+  This resolves to `__builtin_prefetch` on Clang and GCC, which emits the
+  `PREFETCHh` family on x86 and `PRFM` on ARM, and to `_mm_prefetch` or
+  `_m_prefetchw` (i.e., `PrefetchW`) on MSVC. Where none of these is
+  available, it has no effect.
+
+  @remarks (SEEME - bitweeder) Prefetching is easy to get wrong: issue it far
+  enough ahead to hide the memory latency, but not so far that the line is
+  evicted again before use, and measure.
+*/
+#ifndef LBAL_HINT_prefetch
+  #define LBAL_HINT_prefetch(LBAL_addr_, LBAL_rw_, LBAL_locality_)             \
+    static_cast<void>(0)
+#endif
+
+/**
+  @def LBAL_HINT_prefetch_range(LBAL_ptr_, LBAL_bytes_)
+
+  @brief Prefetch every cache line overlapping a range of memory for reading
+
+  @details This steps through `[LBAL_ptr_, LBAL_ptr_ + LBAL_bytes_)` in
+  increments of `LBAL_TARGET_CACHE_LINE_SIZE`, issuing
+  `LBAL_HINT_prefetch(addr, 0, 3)` for each line, including a final partial
+  line. It is used as a statement, and has no effect wherever
+  `LBAL_HINT_prefetch` has none.
+*/
+#ifndef LBAL_HINT_prefetch_range
+  #define LBAL_HINT_prefetch_range(LBAL_ptr_, LBAL_bytes_) static_cast<void>(0)
+#endif
+
+/**
+  @def LBAL_COLD_PATH(...)
+
+  @brief Move a block of rarely-executed code out of line
+
+  @details The arguments form the body of an immediately-invoked lambda,
+  capturing everything by reference, that is marked with
+  `LBAL_LAMBDA_NOINLINE` and `LBAL_LAMBDA_COLD`. This keeps error handling
+  and similar bulky code out of the enclosing function’s instruction
+  stream, e.g.:
+
+  @code
+    if (LBAL_HINT_unlikely(!header.valid())) {
+      return LBAL_COLD_PATH(
+          log_error("bad header", header.dump());
+          return status::corrupt;);
+    }
+  @endcode
+
+  @remarks (SEEME - bitweeder) Since the body is a lambda, a `return`
+  statement inside it only leaves the lambda; its value becomes the value of
+  the `LBAL_COLD_PATH` expression, as above. Likewise, `break`, `continue`,
+  and `goto` can’t reach the enclosing function. Throwing is fine.
+*/
+#ifndef LBAL_COLD_PATH
+  #define LBAL_COLD_PATH(...) [&]() { __VA_ARGS__; }()
+#endif
+
 ///	@}	LBAL_HINT
 
+/**
+  @name LBAL_CONSTEVAL
+
+  @brief Selection between compile-time and run-time implementations
+
+  @details These let a single function offer a `constexpr`-friendly path
+  alongside one built on intrinsics, inline assembly, or other facilities
+  that can’t be used in constant evaluation.
+
+  @{
+*/
+
+/**
+  @def LBAL_IS_CONSTANT_P(LBAL_expr_)
+
+  @brief Test whether an expression is known to be a compile-time constant
+
+  @details This resolves to `__builtin_constant_p` where available, which
+  reports `true` if the optimizer can fold `LBAL_expr_` to a constant at the
+  point of use, e.g., after inlining, and `false` otherwise. Its result can
+  change with the optimization level, so both paths it selects between must
+  produce the same value; it is only a means of picking the cheaper one.
+  `LBAL_expr_` is not evaluated. Where unavailable, this is always `false`.
+*/
+#ifndef LBAL_IS_CONSTANT_P
+  #define LBAL_IS_CONSTANT_P(LBAL_expr_) false
+#endif
+
+/**
+  @def LBAL_IF_CONSTEVAL
+
+  @brief Branch on whether the enclosing function is being constant-evaluated
+
+  @details This is used like the C++23 `if consteval` statement, which it
+  resolves to if available; both branches must be compound statements, e.g.:
+
+  @code
+    constexpr unsigned
+    popcount(unsigned in_value) noexcept {
+      LBAL_IF_CONSTEVAL {
+        unsigned count{0};
+
+        for (; in_value; in_value &= in_value - 1) ++count;
+
+        return count;
+      } else {
+        return __builtin_popcount(in_value);
+      }
+    }
+  @endcode
+
+  Otherwise, this tests `__builtin_is_constant_evaluated()`, or failing that,
+  `std::is_constant_evaluated()`, in which case the client is responsible
+  for including `<type_traits>`. Where none of these is available, the
+  first branch is never taken, so the second must also be usable in
+  constant evaluation if the function is to be.
+
+  @remarks (SEEME - bitweeder) Never place this inside `if constexpr`, or in
+  the condition of one; in the fallback forms, that would always select the
+  compile-time branch.
+*/
+#ifndef LBAL_IF_CONSTEVAL
+  #define LBAL_IF_CONSTEVAL if (false)
+#endif
+
+/**
+  @def LBAL_IF_CONSTEXPR
+
+  @brief `if constexpr`, where available
+
+  @details This resolves to `if constexpr` if `LBAL_CPP17_IF_CONSTEXPR` is
+  set, and to a plain `if` otherwise, for code that must also build as
+  C++11 or C++14; in that case both branches must compile.
+*/
+#ifndef LBAL_IF_CONSTEXPR
+  #define LBAL_IF_CONSTEXPR if
+#endif
+
+///	@}	LBAL_CONSTEVAL
+
 ///	@}	lbal_builtins
 
 /**
@@ -10642,6 +11254,25 @@
   #define LBAL_VIS_HIDDEN
 #endif
 
+/**
+  @def LBAL_VIS_PROTECTED
+
+  @brief Export a symbol without allowing it to be interposed
+
+  @details Like `LBAL_VIS_FUNC_EXPORT`, this makes the symbol visible outside
+  of its shared library, but references from within the library always bind
+  to the library’s own definition, so they can be inlined and called
+  directly rather than through the PLT. This suits hot functions that are
+  part of a library’s interface but that no one has any business replacing.
+
+  @remarks (SEEME - bitweeder) This only exists for ELF. Avoid applying it to
+  variables, as copy relocations in executables make protected data fragile
+  with some linkers; functions are safe.
+*/
+#ifndef LBAL_VIS_PROTECTED
+  #define LBAL_VIS_PROTECTED
+#endif
+
 /**
   @def LBAL_VIS_ENUM
 
@@ -11012,8 +11643,77 @@
   #define LBAL_VIS_EXCEPTION_IMPORT
 #endif
 
+/**
+  @def LBAL_SECTION(LBAL_section_name_)
+
+  @brief Place a function or variable in a named section
+
+  @details `LBAL_section_name_` is a string literal whose format depends on
+  the object file format, e.g., `".text.request"` for ELF, or
+  `"__TEXT,__request,regular,pure_instructions"` for Mach-O, so uses of this
+  are inherently platform-specific. This resolves to nothing for MSVC.
+
+  @remarks (SEEME - bitweeder) Functions and variables must not share a
+  section, and every declaration of an entity must agree on its section.
+*/
+#ifndef LBAL_SECTION
+  #define LBAL_SECTION(LBAL_section_name_)
+#endif
+
 ///	@}	LBAL_VIS
 
+/**
+  @name LBAL_TLS
+
+  @brief Thread-local storage access models
+
+  @details By default, a `thread_local` variable in position-independent
+  code uses the general-dynamic model, which calls `__tls_get_addr` on every
+  access. These decorators select a cheaper model for a particular variable,
+  and are placed before the declaration, e.g.,
+  `LBAL_TLS_INITIAL_EXEC thread_local cache * tls_cache;`. They only exist
+  for ELF platforms; elsewhere, they resolve to nothing.
+
+  @{
+*/
+
+/**
+  @def LBAL_TLS_INITIAL_EXEC
+  Access the variable at a fixed offset from the thread pointer, resolved at
+  load time. This is always valid in an executable and in shared libraries
+  linked against it directly. A shared library loaded with `dlopen` can
+  still use it, but draws on a small static TLS reserve that is shared by
+  every such library, so it should be kept to a few small variables.
+*/
+#ifndef LBAL_TLS_INITIAL_EXEC
+  #define LBAL_TLS_INITIAL_EXEC
+#endif
+
+/**
+  @def LBAL_TLS_LOCAL_EXEC
+  Access the variable at a fixed offset from the thread pointer, resolved at
+  link time; this is the cheapest model, but only valid for variables
+  defined in the executable itself. When `LBAL_BUILD_PIC` is set but
+  `LBAL_BUILD_PIE` is not, i.e., when building what may be a shared library,
+  this falls back to `LBAL_TLS_INITIAL_EXEC`.
+*/
+#ifndef LBAL_TLS_LOCAL_EXEC
+  #define LBAL_TLS_LOCAL_EXEC
+#endif
+
+/**
+  @def LBAL_TLS_LOCAL_DYNAMIC
+  Look up the module’s TLS block once per function, rather than once per
+  variable, and access the variable at a fixed offset from it. This is valid
+  anywhere, but only for variables that aren’t accessed from other modules,
+  e.g., those with internal linkage or hidden visibility.
+*/
+#ifndef LBAL_TLS_LOCAL_DYNAMIC
+  #define LBAL_TLS_LOCAL_DYNAMIC
+#endif
+
+///	@}	LBAL_TLS
+
 /**
   @name LBAL_CLASS
   These tokens describe class decorators whose details are
@@ -11057,6 +11757,23 @@
   #define LBAL_CLASS_FORCE_EBCO
 #endif
 
+/**
+  @def LBAL_CLASS_TRIVIAL_ABI
+  Pass and return objects of this class in registers, as though it were
+  trivially copyable, even though it has a non-trivial destructor or move
+  constructor, e.g., a unique handle or smart pointer. The class is placed
+  after the class key, e.g., `class LBAL_CLASS_TRIVIAL_ABI handle`.
+
+  @remarks (SEEME - bitweeder) This changes the ABI of every function that
+  takes or returns the class by value, and the callee, rather than the
+  caller, becomes responsible for destroying by-value arguments. It is only
+  supported by Clang, and is silently ignored for classes that can’t be
+  passed this way, e.g., those with a non-trivially-relocatable member.
+*/
+#ifndef LBAL_CLASS_TRIVIAL_ABI
+  #define LBAL_CLASS_TRIVIAL_ABI
+#endif
+
 ///	@}	LBAL_CLASS
 
 /**
@@ -11099,6 +11816,276 @@
   #define LBAL_FUNC_CALLBACK_STD(LBAL_func_name_)
 #endif
 
+/**
+  @def LBAL_FUNC_CALL_VECTOR(LBAL_func_name_)
+  Vector calling convention, which passes SIMD arguments and aggregates of
+  them in registers, e.g., `__m256 LBAL_FUNC_CALL_VECTOR(blend)(__m256 a,
+  __m256 b)`. This is `__vectorcall` on Windows for x86 and x64; elsewhere,
+  the default convention already does so, and the name is left as-is.
+*/
+#ifndef LBAL_FUNC_CALL_VECTOR
+  #define LBAL_FUNC_CALL_VECTOR(LBAL_func_name_) LBAL_func_name_
+#endif
+
+/**
+  @def LBAL_FUNC_CALL_REGCALL(LBAL_func_name_)
+  Register calling convention, which passes as many arguments and results as
+  possible in registers, on x86 compilers that support Intel’s `__regcall`;
+  otherwise, the name is left as-is. This changes the function’s mangled
+  name, so it should be applied consistently to every declaration.
+*/
+#ifndef LBAL_FUNC_CALL_REGCALL
+  #define LBAL_FUNC_CALL_REGCALL(LBAL_func_name_) LBAL_func_name_
+#endif
+
+/**
+  @def LBAL_FUNC_PRESERVE_MOST
+  This function preserves nearly all registers for its callers, so calling it
+  from a hot loop, e.g., to refill a buffer or report an error, doesn’t force
+  the loop to spill its live values; in exchange, the function itself is
+  more expensive. This is intended for rarely-taken slow paths, and is only
+  supported by Clang on x86-64 and ARM64.
+*/
+#ifndef LBAL_FUNC_PRESERVE_MOST
+  #define LBAL_FUNC_PRESERVE_MOST
+#endif
+
+/**
+  @def LBAL_FUNC_PRESERVE_NONE
+  This function preserves no general-purpose registers for its callers,
+  which is the converse of `LBAL_FUNC_PRESERVE_MOST`; it suits interpreter
+  handlers and similar functions that tail call one another and never
+  return to a caller with live values. This is only supported by recent
+  versions of Clang on x86-64 and ARM64, and of GCC on x86-64.
+*/
+#ifndef LBAL_FUNC_PRESERVE_NONE
+  #define LBAL_FUNC_PRESERVE_NONE
+#endif
+
+/**
+  @def LBAL_FUNC_FORCE_INLINE
+  Inline this function at every call site, regardless of the optimizer’s
+  cost model; this implies `inline`, and is placed at the start of the
+  declaration, e.g., `LBAL_FUNC_FORCE_INLINE int get() const`. For lambdas,
+  use `LBAL_LAMBDA_FORCE_INLINE` instead.
+*/
+#ifndef LBAL_FUNC_FORCE_INLINE
+  #define LBAL_FUNC_FORCE_INLINE inline
+#endif
+
+/**
+  @def LBAL_FUNC_NOINLINE
+  Never inline this function; useful for keeping rarely-executed code out of
+  hot callers, and for making functions visible to profilers
+*/
+#ifndef LBAL_FUNC_NOINLINE
+  #define LBAL_FUNC_NOINLINE
+#endif
+
+/**
+  @def LBAL_FUNC_FLATTEN
+  Inline every call made from within this function’s body, recursively,
+  where possible; this is placed at the start of the declaration
+*/
+#ifndef LBAL_FUNC_FLATTEN
+  #define LBAL_FUNC_FLATTEN
+#endif
+
+/**
+  @def LBAL_FUNC_HOT
+  This function is executed frequently; optimize it more aggressively and
+  group it with other hot functions in the text section
+*/
+#ifndef LBAL_FUNC_HOT
+  #define LBAL_FUNC_HOT
+#endif
+
+/**
+  @def LBAL_FUNC_COLD
+  This function is rarely executed, e.g., error reporting; optimize it for
+  size, move it out of the way of hot code, and treat branches leading to
+  calls to it as unlikely
+*/
+#ifndef LBAL_FUNC_COLD
+  #define LBAL_FUNC_COLD
+#endif
+
+/**
+  @def LBAL_FUNC_HOT_TEXT
+  Place this function in the hot text section, `.text.hot` for ELF, which
+  the linker can lay out contiguously, so that functions on a request path
+  share i-cache lines and iTLB entries. Unlike `LBAL_FUNC_HOT`, this affects
+  placement only, regardless of optimization flags; the two may be
+  combined. GNU ld groups this section by default, but LLD and mold only do
+  so when linked with `-z keep-text-section-prefix`, which
+  `lbal_target_keep_text_prefixes` adds. For finer-grained ordering, see
+  `lbal_target_symbol_ordering`; both are in
+  `tools/cmake/lbalSymbolOrdering.cmake`.
+*/
+#ifndef LBAL_FUNC_HOT_TEXT
+  #define LBAL_FUNC_HOT_TEXT
+#endif
+
+/**
+  @def LBAL_FUNC_COLD_TEXT
+  Place this function in the cold text section, `.text.unlikely` for ELF,
+  away from the hot code; the placement counterpart to `LBAL_FUNC_COLD`.
+*/
+#ifndef LBAL_FUNC_COLD_TEXT
+  #define LBAL_FUNC_COLD_TEXT
+#endif
+
+/**
+  @def LBAL_FUNC_MALLOC
+  This function returns a pointer to freshly-allocated memory that aliases
+  no other pointer valid at the time of the call, e.g., an arena or pool
+  allocation function
+*/
+#ifndef LBAL_FUNC_MALLOC
+  #define LBAL_FUNC_MALLOC
+#endif
+
+/**
+  @def LBAL_FUNC_ALLOC_SIZE(...)
+  The size in bytes of the memory this function returns is given by the
+  argument at the given 1-based parameter index, or by the product of the
+  arguments at two such indices, as with `calloc`
+*/
+#ifndef LBAL_FUNC_ALLOC_SIZE
+  #define LBAL_FUNC_ALLOC_SIZE(...)
+#endif
+
+/**
+  @def LBAL_FUNC_ALLOC_ALIGN(LBAL_param_index_)
+  The alignment of the memory this function returns is given by the argument
+  at the given 1-based parameter index
+*/
+#ifndef LBAL_FUNC_ALLOC_ALIGN
+  #define LBAL_FUNC_ALLOC_ALIGN(LBAL_param_index_)
+#endif
+
+/**
+  @def LBAL_FUNC_PURE
+  This function has no side effects, and its result depends only on its
+  arguments and on global memory, so repeated calls with no intervening
+  writes may be merged, e.g., a lookup accessor or a hash of a buffer
+*/
+#ifndef LBAL_FUNC_PURE
+  #define LBAL_FUNC_PURE
+#endif
+
+/**
+  @def LBAL_FUNC_CONST
+  This function has no side effects, and its result depends only on the
+  values of its arguments; it may not read memory through pointer arguments
+  or globals. This is stricter than `LBAL_FUNC_PURE`.
+*/
+#ifndef LBAL_FUNC_CONST
+  #define LBAL_FUNC_CONST
+#endif
+
+/**
+  @def LBAL_FUNC_NONNULL(...)
+  The pointer arguments at the given 1-based parameter indices, or all
+  pointer arguments if none are given, are never null; passing null is
+  undefined behavior, and checks against null may be removed
+*/
+#ifndef LBAL_FUNC_NONNULL
+  #define LBAL_FUNC_NONNULL(...)
+#endif
+
+/**
+  @def LBAL_FUNC_RETURNS_NONNULL
+  This function never returns a null pointer
+*/
+#ifndef LBAL_FUNC_RETURNS_NONNULL
+  #define LBAL_FUNC_RETURNS_NONNULL
+#endif
+
+/**
+  @def LBAL_FUNC_ASSUME_ALIGNED_RETURN(LBAL_alignment_)
+  The pointer this function returns is aligned to at least `LBAL_alignment_`
+  bytes, which must be a power of two, e.g., for an arena allocator that
+  hands out cache-line-aligned blocks. This lets callers vectorize over the
+  result without alignment checks or peeling.
+*/
+#ifndef LBAL_FUNC_ASSUME_ALIGNED_RETURN
+  #define LBAL_FUNC_ASSUME_ALIGNED_RETURN(LBAL_alignment_)
+#endif
+
+/**
+  @def LBAL_FUNC_NOPLT
+  Call this function, which must be defined in some other shared object,
+  through its GOT entry rather than a PLT stub, saving a jump per call at the
+  cost of resolving it at load time; cf., `-fno-plt`. This is placed on the
+  declaration and only has an effect in position-independent code on x86.
+*/
+#ifndef LBAL_FUNC_NOPLT
+  #define LBAL_FUNC_NOPLT
+#endif
+
 ///	@}	LBAL_FUNC
 
+/**
+  @def LBAL_RESTRICT
+  Promise that, for the lifetime of the qualified pointer or reference, the
+  object it refers to is only accessed through it (cf., C99 `restrict`).
+  This is placed after the `*` or `&`, e.g., `float * LBAL_RESTRICT out`, or
+  after the parameter list of a member function to qualify `this`. Violating
+  the promise is undefined behavior.
+*/
+#ifndef LBAL_RESTRICT
+  #define LBAL_RESTRICT
+#endif
+
+/**
+  @def LBAL_NO_UNIQUE_ADDRESS
+  Allow this non-static data member to share its address with other members,
+  so that an empty member, e.g., a stateless allocator, comparator, or
+  deleter, occupies no storage (cf., C++20 `[[no_unique_address]]`). This
+  resolves to whichever spelling actually changes layout on the target,
+  which is `[[msvc::no_unique_address]]` for MSVC and the MSVC ABI, and to
+  nothing where neither is honored.
+*/
+#ifndef LBAL_NO_UNIQUE_ADDRESS
+  #define LBAL_NO_UNIQUE_ADDRESS
+#endif
+
+/**
+  @name LBAL_LAMBDA
+  These macros decorate lambda expressions. Compilers disagree about where
+  function attributes go on a lambda, so these have their own spellings,
+  placed after the parameter list (and any `mutable`), but before the
+  trailing return type, if any.
+
+  @{
+*/
+
+/**
+  @def LBAL_LAMBDA_FORCE_INLINE
+  Inline this lambda’s call operator at every call site, e.g.,
+  `[](int x) LBAL_LAMBDA_FORCE_INLINE { return x + 1; }`
+*/
+#ifndef LBAL_LAMBDA_FORCE_INLINE
+  #define LBAL_LAMBDA_FORCE_INLINE
+#endif
+
+/**
+  @def LBAL_LAMBDA_NOINLINE
+  Never inline this lambda’s call operator
+*/
+#ifndef LBAL_LAMBDA_NOINLINE
+  #define LBAL_LAMBDA_NOINLINE
+#endif
+
+/**
+  @def LBAL_LAMBDA_COLD
+  This lambda is rarely executed; see `LBAL_FUNC_COLD`
+*/
+#ifndef LBAL_LAMBDA_COLD
+  #define LBAL_LAMBDA_COLD
+#endif
+
+///	@}	LBAL_LAMBDA
+
 ///	@}	lbal_decorators
@@ -0,0 +1,573 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalPlatformInfo.hpp”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+------------------------------------------------------------------------------*/
+
+/**
+  @file lucenaBAL/lbalPlatformInfo.hpp
+
+  @brief Runtime queries describing the machine the code is running on
+
+  @details The build-time tokens in `<lucenaBAL/lucenaBAL.hpp>` can only
+  describe what the compiler was told to target; these queries report what
+  the host actually provides, e.g., the real cache geometry.
+
+  @remarks Unlike the metaheader, this header is not included by default, as
+  it requires C++17 and pulls in Standard Library and OS headers. Include it
+  explicitly where needed. On Linux, `cpu_topology` may start a helper
+  thread, so clients of this header must link a thread library, e.g.,
+  CMake’s `Threads::Threads`; the `lucenaBAL` target doesn’t impose one.
+*/
+
+#pragma once
+
+//	lbal
+#include <lucenaBAL/lucenaBAL.hpp>
+
+//	std
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if LBAL_cpp_version < LBAL_CPP17_VERSION
+  #error "lbalPlatformInfo.hpp requires C++17 or later"
+#endif
+
+/**
+  @addtogroup lbal_platform_info
+
+  @brief Runtime queries describing the host machine
+
+  @details Each query is evaluated once, on first use, and the result is
+  cached for the lifetime of the process; subsequent calls are cheap. All
+  queries are thread-safe. Where a value cannot be determined on the current
+  platform, it is reported as `0` (or empty), and callers are expected to fall
+  back on the equivalent compile-time estimate, e.g.,
+  `LBAL_TARGET_CACHE_LINE_SIZE`.
+
+  @{
+*/
+
+LBAL_begin_v_namespace
+
+/**
+  @brief Describes a single level of the cache hierarchy
+
+  @details All fields are `0` if the level does not exist or could not be
+  queried.
+*/
+struct cache_level {
+  ///	Total capacity in bytes
+  std::size_t size{0};
+
+  ///	Coherency line size in bytes
+  std::size_t line_size{0};
+
+  ///	Number of ways; `0` if unknown or fully associative
+  unsigned associativity{0};
+
+  ///	Number of logical CPUs sharing a single instance of this cache; when
+  ///	this comes from Intel’s `cpuid` leaf `4`, it is only an upper bound
+  unsigned shared_by{0};
+};
+
+/**
+  @brief Describes the cache hierarchy as seen by the host CPU
+
+  @details On heterogeneous systems, the values describe the
+  highest-performance cores where the platform distinguishes them, and
+  otherwise the first CPU enumerated by the OS.
+*/
+struct cache_hierarchy {
+  cache_level l1d;
+  cache_level l1i;
+  cache_level l2;
+  cache_level l3;
+
+  ///	Coherency line size in bytes; always non-`0`, falling back to
+  ///	`LBAL_TARGET_CACHE_LINE_SIZE` when the host doesn’t report one
+  std::size_t line_size{LBAL_TARGET_CACHE_LINE_SIZE};
+};
+
+/**
+  @brief The kernel’s transparent huge page policy
+
+  @details This mirrors the settings exposed by Linux through
+  `/sys/kernel/mm/transparent_hugepage/enabled`.
+*/
+enum class thp_mode {
+  ///	The platform has no transparent huge page support, or it couldn’t be
+  ///	queried
+  unsupported,
+
+  ///	Huge pages are used wherever possible, without being asked
+  always,
+
+  ///	Huge pages are used only for regions marked with
+  ///	`madvise(MADV_HUGEPAGE)`
+  madvise,
+
+  ///	Transparent huge pages are disabled
+  never
+};
+
+/**
+  @brief Describes a single NUMA node
+*/
+struct numa_node {
+  ///	The OS identifier for this node; these need not be contiguous
+  unsigned id{0};
+
+  ///	The logical CPUs local to this node, in ascending order
+  std::vector<unsigned> cpus;
+
+  ///	Total memory local to this node in bytes; `0` if unknown
+  std::size_t memory{0};
+
+  ///	Relative access cost from this node to each node, indexed in the same
+  ///	order as `numa_topology_info::nodes`; by ACPI convention, local access
+  ///	is `10`
+  std::vector<unsigned> distances;
+};
+
+/**
+  @brief Describes the NUMA layout of the host machine
+
+  @details There is always at least one node; machines without NUMA support,
+  or on which the layout can’t be queried, are described as a single node
+  holding every CPU and all of memory.
+*/
+struct numa_topology_info {
+  ///	Every online node, in ascending order of `numa_node::id`
+  std::vector<numa_node> nodes;
+
+  ///	For each logical CPU, the index into `nodes` of its local node
+  std::vector<unsigned> cpu_to_node;
+
+  ///	@returns The number of online nodes
+  std::size_t
+  node_count() const noexcept {
+    return nodes.size();
+  }
+
+  ///	@returns The relative access cost between two nodes, given as indices
+  ///	into `nodes`, or `0` if unknown
+  unsigned
+  distance(std::size_t in_from, std::size_t in_to) const noexcept {
+    if (in_from >= nodes.size()) return 0;
+
+    auto const & row = nodes[in_from].distances;
+
+    return (in_to < row.size()) ? row[in_to] : 0;
+  }
+};
+
+/**
+  @brief Classifies a core on a heterogeneous (hybrid) system
+*/
+enum class core_kind {
+  ///	The core type couldn’t be determined
+  unknown,
+
+  ///	A high-performance core, e.g., an Intel P-core or an ARM “big” core;
+  ///	on homogeneous systems, every core is reported as this kind
+  performance,
+
+  ///	An efficiency core, e.g., an Intel E-core or an ARM “LITTLE” core
+  efficiency
+};
+
+/**
+  @brief Describes a single logical CPU
+*/
+struct logical_cpu {
+  ///	The OS identifier for this CPU, as used for affinity masks
+  unsigned id{0};
+
+  ///	The physical package (socket) containing this CPU
+  unsigned package{0};
+
+  ///	Index into `cpu_topology_info::cores` of the physical core this CPU
+  ///	belongs to
+  unsigned core{0};
+
+  ///	Index into `cpu_topology_info::cache_groups` of the set of CPUs sharing
+  ///	this CPU’s last-level cache or cluster
+  unsigned cache_group{0};
+
+  ///	The kind of core this CPU belongs to
+  core_kind kind{core_kind::unknown};
+
+  ///	The relative compute capacity reported by the OS, where the fastest
+  ///	core is typically `1024`; `0` if unknown
+  unsigned capacity{0};
+};
+
+/**
+  @brief Describes the processor topology of the host machine
+
+  @details Cores and cache groups are lists of logical CPU identifiers; a
+  core with more than one entry has SMT siblings, and a thread that must not
+  contend with a sibling should claim every CPU in its core.
+*/
+struct cpu_topology_info {
+  ///	Every online logical CPU, in ascending order of `logical_cpu::id`
+  std::vector<logical_cpu> cpus;
+
+  ///	For each physical core, the logical CPUs (SMT siblings) it comprises
+  std::vector<std::vector<unsigned>> cores;
+
+  ///	For each L3 cache, or cluster where there is no L3, the logical CPUs
+  ///	sharing it
+  std::vector<std::vector<unsigned>> cache_groups;
+
+  ///	Whether the system mixes performance and efficiency cores
+  bool hybrid{false};
+
+  ///	@returns The number of physical cores
+  std::size_t
+  physical_core_count() const noexcept {
+    return cores.size();
+  }
+};
+
+namespace details {
+
+//	Return the index of the group with the given members, adding it if new.
+inline unsigned
+group_index(
+    std::vector<std::vector<unsigned>> & io_groups,
+    std::vector<unsigned> const & in_members
+) {
+  for (std::size_t index{0}; index < io_groups.size(); ++index) {
+    if (io_groups[index] == in_members) return static_cast<unsigned>(index);
+  }
+
+  io_groups.push_back(in_members);
+
+  return static_cast<unsigned>(io_groups.size() - 1);
+}
+
+}  //	namespace details
+
+LBAL_end_v_namespace
+
+#include <lucenaBAL/details/lbalCPUID.hpp>
+
+#if LBAL_TARGET_OS_MACOS || LBAL_TARGET_OS_IOS || LBAL_TARGET_OS_IOS_SIM
+  #include <lucenaBAL/details/platforms/lbalPlatformInfoApple.hpp>
+#elif LBAL_TARGET_OS_X11
+  #include <lucenaBAL/details/platforms/lbalPlatformInfoPOSIX.hpp>
+#elif LBAL_TARGET_OS_WINAPI
+  #include <lucenaBAL/details/platforms/lbalPlatformInfoWinAPI.hpp>
+#else
+  #error "Unknown platform; update lbalPlatformInfo.hpp"
+#endif
+
+LBAL_begin_v_namespace
+
+namespace details {
+
+//	Fill in whatever the platform query left blank from `cpuid` leaf 4 (Intel)
+//	or `0x8000001D` (AMD), which share a layout.
+inline void
+query_cache_hierarchy_cpuid(cache_hierarchy & io_caches) noexcept {
+  cpuid_registers registers;
+  std::uint32_t leaf{0};
+
+  if (cpuid(0x8000001Du, 0, registers) && (registers.eax & 0x1Fu)) {
+    leaf = 0x8000001Du;
+  } else if (cpuid(4, 0, registers) && (registers.eax & 0x1Fu)) {
+    leaf = 4;
+  } else {
+    return;
+  }
+
+  for (std::uint32_t index{0}; (index < 16) && cpuid(leaf, index, registers);
+       ++index) {
+    auto const type = registers.eax & 0x1Fu;
+    auto const level = (registers.eax >> 5) & 0x7u;
+
+    if (0 == type) break;
+
+    cache_level entry;
+    entry.line_size = (registers.ebx & 0xFFFu) + 1;
+    entry.associativity = ((registers.ebx >> 22) & 0x3FFu) + 1;
+    entry.shared_by = ((registers.eax >> 14) & 0xFFFu) + 1;
+
+    //	SEEME - bitweeder
+    //	AMD reports the actual number of sharers, but Intel reports the number
+    //	of APIC IDs reserved for them, a power-of-two upper bound that often
+    //	exceeds the CPUs present; the best we can do without visiting every
+    //	CPU is to clamp it to the number that exist.
+    if (4 == leaf) {
+      auto const cpu_count = std::thread::hardware_concurrency();
+
+      if (cpu_count && (entry.shared_by > cpu_count)) {
+        entry.shared_by = cpu_count;
+      }
+    }
+
+    entry.size = std::size_t{entry.associativity}
+               * (((registers.ebx >> 12) & 0x3FFu) + 1)
+               * entry.line_size
+               * (std::size_t{registers.ecx} + 1);
+
+    if (registers.eax & (1u << 9)) entry.associativity = 0;
+
+    cache_level * target{nullptr};
+
+    if ((1 == level) && (1 == type)) {
+      target = &io_caches.l1d;
+    } else if ((1 == level) && (2 == type)) {
+      target = &io_caches.l1i;
+    } else if (2 == level) {
+      target = &io_caches.l2;
+    } else if (3 == level) {
+      target = &io_caches.l3;
+    }
+
+    if (target && (0 == target->size)) *target = entry;
+  }
+}
+
+}  //	namespace details
+
+/**
+  @brief Report the cache hierarchy of the host machine
+
+  @details Values come from the most authoritative source available on the
+  platform: sysfs and `sysconf` on Linux, `sysctl` on Apple platforms,
+  `GetLogicalProcessorInformation` on Windows, and `cpuid` on x86 as a
+  fallback everywhere.
+
+  @returns A reference to a process-wide, immutable description of the cache
+  hierarchy
+*/
+inline cache_hierarchy const &
+cache_info() {
+  static cache_hierarchy const caches = [] {
+    cache_hierarchy result;
+
+    details::query_cache_hierarchy(result);
+    details::query_cache_hierarchy_cpuid(result);
+
+    if (result.l1d.line_size) {
+      result.line_size = result.l1d.line_size;
+    } else if (result.l2.line_size) {
+      result.line_size = result.l2.line_size;
+    }
+
+    return result;
+  }();
+
+  return caches;
+}
+
+/**
+  @brief Report the base page size of the host machine
+
+  @details This is the granularity of `mmap`, `mprotect`, `VirtualAlloc`,
+  and friends, and may differ from `LBAL_TARGET_PAGE_SIZE_DEFAULT`, e.g., on
+  AArch64 Linux kernels built for 16 KiB or 64 KiB pages.
+
+  @returns The page size in bytes; never `0`
+*/
+inline std::size_t
+page_size() {
+  static std::size_t const size = [] {
+    auto const result = details::query_page_size();
+
+    return result ? result : std::size_t{LBAL_TARGET_PAGE_SIZE_DEFAULT};
+  }();
+
+  return size;
+}
+
+/**
+  @brief Report the explicit huge page sizes the host kernel supports
+
+  @details On Linux, these are the sizes listed under
+  `/sys/kernel/mm/hugepages`, usable with `MAP_HUGETLB`; on Windows, this is
+  the large page minimum, usable with `MEM_LARGE_PAGES`. Support does not
+  imply that any pages of a given size are actually reserved, or that the
+  process has the privileges to use them.
+
+  @returns A reference to a process-wide list of sizes in bytes, in
+  ascending order; empty if huge pages are unavailable or unknown
+*/
+inline std::vector<std::size_t> const &
+huge_page_sizes() {
+  static std::vector<std::size_t> const sizes = [] {
+    std::vector<std::size_t> result;
+
+    details::query_huge_page_sizes(result);
+
+    return result;
+  }();
+
+  return sizes;
+}
+
+/**
+  @brief Report the host kernel’s transparent huge page policy
+
+  @details This is only meaningful on Linux; elsewhere, it is always
+  `thp_mode::unsupported`. Callers that want huge pages under
+  `thp_mode::madvise` must align their regions to the huge page size and
+  request them explicitly.
+
+  @returns The system-wide policy; note that it can be changed at runtime by
+  an administrator, but is sampled only once per process
+*/
+inline thp_mode
+transparent_huge_pages_mode() {
+  static thp_mode const mode{details::query_thp_mode()};
+
+  return mode;
+}
+
+/**
+  @brief Report the NUMA topology of the host machine
+
+  @details On Linux, this is read from `/sys/devices/system/node`, without
+  any dependency on libnuma. Elsewhere, and wherever sysfs is unavailable,
+  the machine is described as a single node.
+
+  @returns A reference to a process-wide, immutable description of the NUMA
+  topology; this is sampled once, and does not track CPU or memory hotplug
+*/
+inline numa_topology_info const &
+numa_topology() {
+  static numa_topology_info const topology = [] {
+    numa_topology_info result;
+
+    if (!details::query_numa_topology(result) || result.nodes.empty()) {
+      numa_node node;
+
+      for (unsigned cpu{0}, count{std::thread::hardware_concurrency()};
+           cpu < count; ++cpu) {
+        node.cpus.push_back(cpu);
+      }
+
+      node.memory = details::query_physical_memory();
+      node.distances.push_back(10);
+
+      result.nodes.assign(1, std::move(node));
+    }
+
+    for (std::size_t index{0}; index < result.nodes.size(); ++index) {
+      for (auto const cpu : result.nodes[index].cpus) {
+        if (cpu >= result.cpu_to_node.size()) {
+          result.cpu_to_node.resize(cpu + 1, 0);
+        }
+
+        result.cpu_to_node[cpu] = static_cast<unsigned>(index);
+      }
+    }
+
+    return result;
+  }();
+
+  return topology;
+}
+
+/**
+  @brief Report the processor topology of the host machine
+
+  @details On Linux, this is read from `/sys/devices/system/cpu`. Hybrid
+  cores are classified from the kernel’s `cpu_core`/`cpu_atom` PMU lists or
+  `cpuid` leaf `0x1A` on x86, and from `cpu_capacity` on ARM, where the cores
+  with the highest capacity are deemed performance cores and all others
+  efficiency cores. On Windows, this comes from
+  `GetLogicalProcessorInformationEx`. On Apple platforms, it comes from the
+  `hw.perflevelN` sysctls, where `perflevel0` holds the performance cores.
+  Elsewhere, every logical CPU is reported as its own core in a single cache
+  group.
+
+  @remarks The `cpuid` fallback must run on each CPU in turn, so it briefly
+  starts a helper thread and pins that; the calling thread’s affinity is
+  left alone.
+
+  @remarks (SEEME - bitweeder) Apple platforms don’t support thread affinity
+  at all, so their CPU identifiers are nominal, numbered by core type; use
+  QoS classes to steer work between core types there.
+
+  @returns A reference to a process-wide, immutable description of the
+  processor topology; this is sampled once, and does not track CPU hotplug
+*/
+inline cpu_topology_info const &
+cpu_topology() {
+  static cpu_topology_info const topology = [] {
+    cpu_topology_info result;
+
+    if (!details::query_cpu_topology(result) || result.cpus.empty()) {
+      result = cpu_topology_info{};
+      result.cache_groups.emplace_back();
+
+      for (unsigned id{0}, count{std::thread::hardware_concurrency()};
+           id < count; ++id) {
+        logical_cpu cpu;
+
+        cpu.id = id;
+        cpu.core = static_cast<unsigned>(result.cores.size());
+
+        result.cores.push_back({id});
+        result.cache_groups.front().push_back(id);
+        result.cpus.push_back(cpu);
+      }
+    }
+
+    //	Fall back on relative capacity for anything the platform couldn’t
+    //	classify directly.
+    unsigned max_capacity{0};
+    unsigned min_capacity{~0u};
+
+    for (auto const & cpu : result.cpus) {
+      if (!cpu.capacity) continue;
+
+      if (cpu.capacity > max_capacity) max_capacity = cpu.capacity;
+      if (cpu.capacity < min_capacity) min_capacity = cpu.capacity;
+    }
+
+    if (max_capacity && (max_capacity != min_capacity)) {
+      for (auto & cpu : result.cpus) {
+        if ((core_kind::unknown == cpu.kind) && cpu.capacity) {
+          cpu.kind = (max_capacity == cpu.capacity) ? core_kind::performance
+                                                    : core_kind::efficiency;
+        }
+      }
+    }
+
+    bool has_performance{false};
+    bool has_efficiency{false};
+
+    for (auto const & cpu : result.cpus) {
+      has_performance = has_performance || (core_kind::performance == cpu.kind);
+      has_efficiency = has_efficiency || (core_kind::efficiency == cpu.kind);
+    }
+
+    result.hybrid = has_performance && has_efficiency;
+
+    if (!result.hybrid) {
+      for (auto & cpu : result.cpus) cpu.kind = core_kind::performance;
+    }
+
+    return result;
+  }();
+
+  return topology;
+}
+
+LBAL_end_v_namespace
+
+///	@}	lbal_platform_info
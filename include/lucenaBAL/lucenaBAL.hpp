@@ -68,6 +68,14 @@
   they capture more information than the SD-6 tags. See the relevant sections
   for more information.
 
+  A small number of facilities can’t reasonably be expressed as macros, e.g.,
+  type-dependent constants. These live in separate opt-in headers, such as
+  `<lucenaBAL/lbalBuiltins.hpp>`, which are not included by this metaheader;
+  they require C++17 and may pull in additional Standard Library headers.
+  Likewise, `<lucenaBAL/lbalPlatformInfo.hpp>` provides
+  [runtime queries](@ref lbal_platform_info) of the host machine, which
+  complement the build-time descriptors.
+
 
   @section lbal_notes Header Notes
 
@@ -107,6 +115,7 @@
   @defgroup lbal_compiler_control Diagnostics, Pragmas, and Warnings
   @defgroup lbal_builtins Compiler Intrinsics & Built-in Functions
   @defgroup lbal_decorators Linker Decorators
+  @defgroup lbal_platform_info Runtime Platform Queries
 */
 
 #include <lucenaBAL/lbalConfig.hpp>
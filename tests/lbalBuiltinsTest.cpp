@@ -0,0 +1,404 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalBuiltinsTest”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+------------------------------------------------------------------------------*/
+
+//	lbal
+#include <lucenaBAL/lbalBuiltins.hpp>
+
+//  gtest
+#include <gtest/gtest.h>
+
+//	std
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+using namespace LBAL_;
+
+/*------------------------------------------------------------------------------
+ */
+
+GTEST_TEST(lbalTest, NativeSIMDWidth) {
+  static_assert(
+      LBAL_TARGET_VEC_NATIVE_BYTES == 0
+          || LBAL_TARGET_VEC_NATIVE_BYTES == 16
+          || LBAL_TARGET_VEC_NATIVE_BYTES == 32
+          || LBAL_TARGET_VEC_NATIVE_BYTES == 64
+          || (LBAL_TARGET_VEC_SVE && (LBAL_TARGET_VEC_NATIVE_BYTES % 16 == 0)),
+      "Unexpected native vector width"
+  );
+
+  static_assert(
+      (LBAL_TARGET_VEC_NATIVE_BYTES == 0)
+          == (LBAL_TARGET_VEC_REGISTER_COUNT == 0),
+      "Vector width and register count disagree"
+  );
+
+#if LBAL_TARGET_CPU_X86_64
+  EXPECT_GE(LBAL_TARGET_VEC_NATIVE_BYTES, 16);
+  EXPECT_GE(LBAL_TARGET_VEC_REGISTER_COUNT, 16);
+#elif LBAL_TARGET_CPU_ARM_64
+  EXPECT_GE(LBAL_TARGET_VEC_NATIVE_BYTES, 16);
+  EXPECT_EQ(LBAL_TARGET_VEC_REGISTER_COUNT, 32);
+#endif
+
+  static_assert(native_simd_lanes<char> >= 1, "");
+  static_assert(
+      native_simd_lanes<std::uint8_t>
+          == (LBAL_TARGET_VEC_NATIVE_BYTES ? LBAL_TARGET_VEC_NATIVE_BYTES : 1),
+      ""
+  );
+
+#if LBAL_TARGET_VEC_NATIVE_BYTES
+  EXPECT_EQ(native_simd_lanes<float> * sizeof(float),
+      std::size_t{LBAL_TARGET_VEC_NATIVE_BYTES});
+  EXPECT_EQ(native_simd_lanes<double> * 2, native_simd_lanes<float>);
+#else
+  EXPECT_EQ(native_simd_lanes<float>, 1u);
+  EXPECT_EQ(native_simd_lanes<double>, 1u);
+#endif
+}
+
+namespace {
+
+int
+sum_multiple_of_four(int const * in_values, int in_count) noexcept {
+  LBAL_HINT_assume((in_count >= 0) && (in_count % 4 == 0));
+
+  int result{0};
+
+  for (int i{0}; i < in_count; ++i) result += in_values[i];
+
+  return result;
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, Assume) {
+  int const values[]{1, 2, 3, 4, 5, 6, 7, 8};
+
+  EXPECT_EQ(sum_multiple_of_four(values, 8), 36);
+  EXPECT_EQ(sum_multiple_of_four(values, 4), 10);
+  EXPECT_EQ(sum_multiple_of_four(values, 0), 0);
+
+#if LBAL_CONFIG_check_assumptions && GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(sum_multiple_of_four(values, 3), "assumption violated");
+#endif
+}
+
+namespace {
+
+enum class opcode { load, store, branch };
+
+int
+decode(opcode in_op) noexcept {
+  switch (in_op) {
+    case opcode::load:
+      return 1;
+
+    case opcode::store:
+      return 2;
+
+    case opcode::branch:
+      return 3;
+  }
+
+  LBAL_HINT_unreachable();
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, Unreachable) {
+  EXPECT_EQ(decode(opcode::load), 1);
+  EXPECT_EQ(decode(opcode::store), 2);
+  EXPECT_EQ(decode(opcode::branch), 3);
+
+#if defined(LBAL_CONFIG_debug) && LBAL_CONFIG_debug && GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(decode(static_cast<opcode>(7)), "unreachable code reached");
+#endif
+}
+
+namespace {
+
+int
+classify(int in_value) noexcept {
+  switch (in_value) {
+    LBAL_LIKELY case 0:
+      return 0;
+
+    LBAL_UNLIKELY default:
+      break;
+  }
+
+  if (LBAL_HINT_expect_probability(in_value > 0, true, 0.9)) LBAL_LIKELY {
+    return 1;
+  }
+
+  return -1;
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, BranchHints) {
+  EXPECT_EQ(classify(0), 0);
+  EXPECT_EQ(classify(5), 1);
+  EXPECT_EQ(classify(-5), -1);
+
+  EXPECT_TRUE(LBAL_HINT_likely(classify(5) == 1));
+  EXPECT_FALSE(LBAL_HINT_unlikely(classify(5) != 1));
+  EXPECT_FALSE(LBAL_HINT_expect_probability(classify(-5) > 0, false, 0.25));
+}
+
+GTEST_TEST(lbalTest, Select) {
+  enum class color : std::uint8_t { red, green };
+
+  int const values[]{3, -7, 12, 0};
+  int smallest{values[0]};
+
+  for (auto const value : values) {
+    smallest = select(LBAL_HINT_unpredictable(value < smallest), value,
+        smallest);
+  }
+
+  EXPECT_EQ(smallest, -7);
+  EXPECT_EQ(select(true, 1.5, -2.0), 1.5);
+  EXPECT_EQ(select(false, 1.5f, -2.0f), -2.0f);
+  EXPECT_EQ(select(true, color::green, color::red), color::green);
+  EXPECT_EQ(select(false, &values[0], &values[3]), &values[3]);
+  EXPECT_EQ(select<std::int16_t>(true, -1, 2), -1);
+  EXPECT_EQ(select<std::uint64_t>(false, 0, ~std::uint64_t{0}),
+      ~std::uint64_t{0});
+}
+
+namespace {
+
+alignas(64) float lane_storage[32]{};
+
+LBAL_FUNC_ASSUME_ALIGNED_RETURN(64) float *
+lane_block() noexcept {
+  return lane_storage;
+}
+
+float
+sum_lanes(float const * in_lanes, int in_count) noexcept {
+  auto const * const lanes = LBAL_HINT_assume_aligned(in_lanes, 64);
+  float result{0.0f};
+
+  for (int i{0}; i < in_count; ++i) result += lanes[i];
+
+  return result;
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, AssumeAligned) {
+  float * const lanes{lane_block()};
+
+  for (int i{0}; i < 32; ++i) lanes[i] = 1.0f;
+
+  EXPECT_EQ(LBAL_HINT_assume_aligned(lanes, 16), lanes);
+  EXPECT_EQ(sum_lanes(lanes, 32), 32.0f);
+
+#if LBAL_CONFIG_check_assumptions && GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(sum_lanes(lanes + 1, 4), "misaligned pointer");
+#endif
+}
+
+GTEST_TEST(lbalTest, OptimizationBarriers) {
+  int buffer[16]{};
+  int const seed{7};
+  long total{0};
+
+  for (int round{0}; round < 4; ++round) {
+    int input{seed};
+
+    //	Without the barrier, this would all fold to a constant.
+    do_not_optimize(input);
+    total += input * 3;
+    do_not_optimize(total);
+  }
+
+  int * const pointer{buffer};
+
+  do_not_optimize(pointer);
+
+  for (int i{0}; i < 16; ++i) pointer[i] = i;
+
+  clobber_memory();
+
+  struct wide {
+    double values[4];
+  } const block{{1.0, 2.0, 3.0, 4.0}};
+
+  do_not_optimize(block);
+
+  EXPECT_EQ(total, 84);
+  EXPECT_EQ(buffer[15], 15);
+  EXPECT_EQ(block.values[3], 4.0);
+}
+
+namespace {
+
+//	Reports which path was taken, so the test can tell them apart.
+constexpr int
+evaluation_path() noexcept {
+  LBAL_IF_CONSTEVAL {
+    return 1;
+  } else {
+    return 2;
+  }
+}
+
+template <typename T>
+constexpr int
+integral_tag() noexcept {
+  LBAL_IF_CONSTEXPR (std::is_integral_v<T>) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, ConstantEvaluation) {
+  constexpr int compile_time{evaluation_path()};
+  int run_time{evaluation_path()};
+  volatile int opaque{3};
+
+  //	With no way to detect constant evaluation, the first branch is never
+  //	taken.
+#if LBAL_CPP23_IF_CONSTEVAL || LBAL_LIBCPP20_IS_CONSTANT_EVALUATED             \
+    || LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC
+  EXPECT_EQ(compile_time, 1);
+#else
+  EXPECT_EQ(compile_time, 2);
+#endif
+
+  EXPECT_EQ(run_time, 2);
+
+  static_assert(integral_tag<int>() == 1, "LBAL_IF_CONSTEXPR failed");
+  static_assert(integral_tag<float>() == 0, "LBAL_IF_CONSTEXPR failed");
+
+  EXPECT_FALSE(LBAL_IS_CONSTANT_P(opaque + 1));
+
+#if LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC
+  EXPECT_TRUE(LBAL_IS_CONSTANT_P(2 + 3));
+#endif
+}
+
+GTEST_TEST(lbalTest, Prefetch) {
+  alignas(LBAL_TARGET_CACHE_LINE_SIZE) char buffer[1024]{};
+
+  //	Prefetches have no observable effect; these just need to compile and
+  //	not fault, including on addresses that are never dereferenced.
+  LBAL_HINT_prefetch(buffer, 0, 3);
+  LBAL_HINT_prefetch(buffer + 64, 1, 0);
+  LBAL_HINT_prefetch(static_cast<void const *>(nullptr), 0, 1);
+
+  LBAL_HINT_prefetch_range(buffer, sizeof(buffer));
+  LBAL_HINT_prefetch_range(buffer + 3, 70);
+  LBAL_HINT_prefetch_range(buffer, 0);
+
+  EXPECT_EQ(buffer[0], 0);
+}
+
+GTEST_TEST(lbalTest, LoopPragmas) {
+  float values[64]{};
+  float sum{0.0f};
+
+  LBAL_LOOP_VECTORIZE
+  LBAL_LOOP_VECTORIZE_WIDTH(4)
+  LBAL_LOOP_IVDEP
+  for (int i{0}; i < 64; ++i) values[i] = static_cast<float>(i);
+
+  LBAL_LOOP_UNROLL(8)
+  for (int i{0}; i < 64; ++i) sum += values[i];
+
+  int steps{0};
+
+  LBAL_LOOP_NO_UNROLL
+  while (steps < 3) ++steps;
+
+  EXPECT_EQ(sum, 2016.0f);
+  EXPECT_EQ(steps, 3);
+}
+
+GTEST_TEST(lbalTest, StreamingStores) {
+  struct alignas(16) quad {
+    std::uint32_t values[4];
+  };
+
+  struct alignas(32) octet {
+    std::uint64_t values[4];
+  };
+
+  int word{0};
+  std::uint64_t wide{0};
+  quad block{};
+  octet line{};
+
+  stream_store(&word, 42);
+  stream_store(&wide, std::uint64_t{0x0123456789ABCDEFu});
+  stream_store(&block, quad{{1, 2, 3, 4}});
+  stream_store(&line, octet{{5, 6, 7, 8}});
+  stream_fence();
+
+  EXPECT_EQ(stream_load(&word), 42);
+  EXPECT_EQ(stream_load(&wide), 0x0123456789ABCDEFu);
+  EXPECT_EQ(stream_load(&block).values[3], 4u);
+  EXPECT_EQ(stream_load(&line).values[2], 7u);
+
+  //	Without a 32-byte store, each of these splits into narrower ones.
+  octet lines[4]{};
+
+  for (std::uint64_t i{0}; i < 4; ++i) {
+    stream_store(&lines[i], octet{{i, i + 1, i + 2, i + 3}});
+  }
+
+  stream_fence();
+
+  for (std::uint64_t i{0}; i < 4; ++i) {
+    EXPECT_EQ(lines[i].values[0], i);
+    EXPECT_EQ(lines[i].values[3], i + 3);
+  }
+
+  //	Fall back to a nominal block on targets without streaming stores, so
+  //	that the loops below still cover something.
+  constexpr std::size_t stream_block{
+      details::stream_block_bytes ? details::stream_block_bytes : 16};
+  constexpr std::size_t capacity{4096 + 4 * stream_block};
+
+  auto const source = std::make_unique<unsigned char[]>(capacity);
+  auto const dest = std::make_unique<unsigned char[]>(capacity);
+
+  for (std::size_t i{0}; i < capacity; ++i) {
+    source[i] = static_cast<unsigned char>(i * 7 + 1);
+  }
+
+  //	Cover both sides of the short-path cutoff, and every destination
+  //	misalignment within a block, which with the larger sizes also covers
+  //	every tail length.
+  for (std::size_t const size : {std::size_t{0}, std::size_t{5},
+           2 * stream_block - 1, 2 * stream_block, 2 * stream_block + 1,
+           std::size_t{100}, std::size_t{4096}}) {
+    for (std::size_t offset{0}; offset <= stream_block; ++offset) {
+      std::fill_n(dest.get(), capacity, static_cast<unsigned char>(0));
+
+      EXPECT_EQ(memcpy_streaming(dest.get() + offset, source.get() + 3, size),
+          dest.get() + offset);
+      EXPECT_TRUE(std::equal(
+          source.get() + 3, source.get() + 3 + size, dest.get() + offset));
+      EXPECT_EQ(dest[offset + size], 0);
+    }
+  }
+}
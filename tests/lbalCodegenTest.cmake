@@ -0,0 +1,62 @@
+#[[#############################################################################
+
+  Lucena Build Abstraction Library
+  “lbalTest/lbalCodegenTest.cmake”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+	Compiles a source file to assembly and fails if it contains a conditional
+	branch. This is run as a script by CTest, e.g.:
+
+		cmake -DCOMPILER=<path> -DSOURCE=<path> -DOUTPUT=<path>
+			-DINCLUDE_DIR=<path> -DDEFINITIONS=<a,b,...>
+			-P lbalCodegenTest.cmake
+
+	Only GCC-style drivers are supported.
+
+##############################################################################]]
+
+
+#[[#############################################################################
+  compile
+#]]
+
+foreach (required COMPILER SOURCE OUTPUT INCLUDE_DIR)
+	if (NOT DEFINED ${required})
+		message (FATAL_ERROR "lbalCodegenTest: ${required} is not set")
+	endif()
+endforeach()
+
+string (REPLACE "," ";" definitions "${DEFINITIONS}")
+list (TRANSFORM definitions PREPEND "-D")
+
+execute_process (
+	COMMAND
+		${COMPILER} -std=c++17 -O2 -S ${definitions}
+		"-I${INCLUDE_DIR}" "${SOURCE}" -o "${OUTPUT}"
+	RESULT_VARIABLE result
+	ERROR_VARIABLE errors
+)
+
+if (NOT result EQUAL 0)
+	message (FATAL_ERROR "lbalCodegenTest: compilation failed\n${errors}")
+endif()
+
+
+#[[#############################################################################
+  scan
+#]]
+
+# These are the conditional branches of x86 (every `jcc` but `jmp`) and ARM64
+# (`b.cond`, `cbz`/`cbnz`, and `tbz`/`tbnz`).
+file (STRINGS "${OUTPUT}" branches
+	REGEX "^[ \t]+(j[a-ln-z][a-z]*|b\\.[a-z]+|cbn?z|tbn?z)[ \t]")
+
+if (branches)
+	list (JOIN branches "\n" listing)
+	message (FATAL_ERROR
+		"lbalCodegenTest: conditional branches in ${OUTPUT}:\n${listing}")
+endif()
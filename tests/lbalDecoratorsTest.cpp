@@ -0,0 +1,487 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalDecoratorsTest”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+------------------------------------------------------------------------------*/
+
+//	lbal
+#include <lucenaBAL/lucenaBAL.hpp>
+
+//  gtest
+#include <gtest/gtest.h>
+
+//	std
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+
+/*------------------------------------------------------------------------------
+  Most decorators have no observable effect at runtime; these tests exist to
+  ensure each one is accepted by the compiler in its documented position.
+*/
+
+namespace {
+
+LBAL_FUNC_FORCE_INLINE int
+add_one(int in_value) noexcept {
+  return in_value + 1;
+}
+
+LBAL_FUNC_NOINLINE int
+times_two(int in_value) noexcept {
+  return in_value * 2;
+}
+
+LBAL_FUNC_FLATTEN int
+flattened(int in_value) noexcept {
+  return add_one(times_two(in_value));
+}
+
+struct inline_members {
+  LBAL_FUNC_FORCE_INLINE int
+  value() const noexcept {
+    return 7;
+  }
+
+  static LBAL_FUNC_FORCE_INLINE int
+  static_value() noexcept {
+    return 11;
+  }
+};
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, InliningDecorators) {
+  EXPECT_EQ(add_one(1), 2);
+  EXPECT_EQ(times_two(3), 6);
+  EXPECT_EQ(flattened(4), 9);
+  EXPECT_EQ(inline_members{}.value(), 7);
+  EXPECT_EQ(inline_members::static_value(), 11);
+
+  auto const add_three = [](int in_value) LBAL_LAMBDA_FORCE_INLINE {
+    return in_value + 3;
+  };
+
+  int total{0};
+  auto accumulate = [&total](int in_value) mutable LBAL_LAMBDA_FORCE_INLINE
+      -> int { return total += in_value; };
+
+  EXPECT_EQ(add_three(2), 5);
+  EXPECT_EQ(accumulate(5), 5);
+  EXPECT_EQ(accumulate(5), 10);
+}
+
+namespace {
+
+LBAL_FUNC_COLD LBAL_FUNC_NOINLINE void
+report_failure(int & io_failures) noexcept {
+  ++io_failures;
+}
+
+LBAL_FUNC_HOT int
+checked_sum(int const * in_values, int in_count, int & io_failures) {
+  int result{0};
+
+  for (int i{0}; i < in_count; ++i) {
+    if (LBAL_HINT_unlikely(in_values[i] < 0)) {
+      report_failure(io_failures);
+
+      return LBAL_COLD_PATH(
+          if (in_values[i] < -100) throw std::out_of_range{"too negative"};
+          return -1;);
+    }
+
+    result += in_values[i];
+  }
+
+  return result;
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, HotColdDecorators) {
+  int const good[]{1, 2, 3};
+  int const bad[]{1, -2, 3};
+  int const worse[]{1, -200, 3};
+  int failures{0};
+
+  EXPECT_EQ(checked_sum(good, 3, failures), 6);
+  EXPECT_EQ(failures, 0);
+  EXPECT_EQ(checked_sum(bad, 3, failures), -1);
+  EXPECT_EQ(failures, 1);
+  EXPECT_THROW(checked_sum(worse, 3, failures), std::out_of_range);
+  EXPECT_EQ(failures, 2);
+
+  int counter{0};
+
+  LBAL_COLD_PATH(++counter; counter *= 10);
+  EXPECT_EQ(counter, 10);
+
+  auto const rare = [](int in_value) LBAL_LAMBDA_NOINLINE LBAL_LAMBDA_COLD {
+    return -in_value;
+  };
+
+  EXPECT_EQ(rare(4), -4);
+}
+
+namespace {
+
+void
+scale(
+    float * LBAL_RESTRICT o_values,
+    float const * LBAL_RESTRICT in_values,
+    std::size_t in_count,
+    float const & LBAL_RESTRICT in_factor
+) noexcept {
+  for (std::size_t i{0}; i < in_count; ++i) {
+    o_values[i] = in_values[i] * in_factor;
+  }
+}
+
+struct accumulator {
+  int total{0};
+
+  void
+  add(int in_value) LBAL_RESTRICT {
+    total += in_value;
+  }
+};
+
+//	A trivial bump allocator; `std::aligned_alloc` isn’t available everywhere.
+LBAL_FUNC_MALLOC LBAL_FUNC_ALLOC_SIZE(1) LBAL_FUNC_ALLOC_ALIGN(2) void *
+aligned_block(std::size_t in_size, std::size_t in_alignment) noexcept {
+  alignas(256) static unsigned char arena[1024];
+  static std::size_t used{0};
+
+  auto const start = (used + in_alignment - 1) & ~(in_alignment - 1);
+
+  if (start + in_size > sizeof(arena)) return nullptr;
+
+  used = start + in_size;
+
+  return arena + start;
+}
+
+LBAL_FUNC_MALLOC LBAL_FUNC_ALLOC_SIZE(1, 2) void *
+zeroed_array(std::size_t in_count, std::size_t in_size) noexcept {
+  return std::calloc(in_count, in_size);
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, AliasingDecorators) {
+  float const input[]{1.0f, 2.0f, 3.0f};
+  float output[3]{};
+
+  scale(output, input, 3, 2.0f);
+  EXPECT_EQ(output[2], 6.0f);
+
+  accumulator sum;
+
+  sum.add(2);
+  sum.add(3);
+  EXPECT_EQ(sum.total, 5);
+
+  void * block{aligned_block(1, 1)};
+
+  ASSERT_NE(block, nullptr);
+  block = aligned_block(256, 64);
+
+  ASSERT_NE(block, nullptr);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % 64, 0u);
+
+  auto * zeroes = static_cast<int *>(zeroed_array(4, sizeof(int)));
+
+  ASSERT_NE(zeroes, nullptr);
+  EXPECT_EQ(zeroes[3], 0);
+  std::free(zeroes);
+}
+
+namespace {
+
+LBAL_FUNC_CONST int
+mix(int in_value) noexcept {
+  return (in_value * 31) ^ (in_value >> 3);
+}
+
+LBAL_FUNC_PURE LBAL_FUNC_NONNULL(1) std::size_t
+hash_bytes(char const * in_bytes, std::size_t in_count) noexcept {
+  std::size_t result{14695981039346656037ull & ~std::size_t{0}};
+
+  for (std::size_t i{0}; i < in_count; ++i) {
+    result ^= static_cast<unsigned char>(in_bytes[i]);
+    result *= 1099511628211u;
+  }
+
+  return result;
+}
+
+LBAL_FUNC_RETURNS_NONNULL LBAL_FUNC_NONNULL() int *
+larger_of(int * in_lhs, int * in_rhs) noexcept {
+  return (*in_lhs < *in_rhs) ? in_rhs : in_lhs;
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, PurityDecorators) {
+  EXPECT_EQ(mix(8), mix(8));
+  EXPECT_EQ(mix(0), 0);
+
+  char const text[]{"lucena"};
+
+  EXPECT_EQ(hash_bytes(text, 6), hash_bytes(text, 6));
+  EXPECT_NE(hash_bytes(text, 6), hash_bytes(text, 5));
+
+  int lhs{4};
+  int rhs{5};
+
+  EXPECT_EQ(larger_of(&lhs, &rhs), &rhs);
+}
+
+namespace {
+
+struct lanes {
+  float values[4];
+};
+
+lanes LBAL_FUNC_CALL_VECTOR(add_lanes)(lanes in_lhs, lanes in_rhs) noexcept {
+  for (int i{0}; i < 4; ++i) in_lhs.values[i] += in_rhs.values[i];
+
+  return in_lhs;
+}
+
+int LBAL_FUNC_CALL_REGCALL(madd)(int in_a, int in_b, int in_c) noexcept {
+  return (in_a * in_b) + in_c;
+}
+
+int refills{0};
+
+LBAL_FUNC_PRESERVE_MOST LBAL_FUNC_NOINLINE void
+refill() noexcept {
+  ++refills;
+}
+
+LBAL_FUNC_PRESERVE_NONE LBAL_FUNC_NOINLINE int
+dispatch(int in_opcode) noexcept {
+  return in_opcode + 1;
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, CallingConventions) {
+  lanes const lhs{{1.0f, 2.0f, 3.0f, 4.0f}};
+  lanes const rhs{{4.0f, 3.0f, 2.0f, 1.0f}};
+
+  EXPECT_EQ(add_lanes(lhs, rhs).values[3], 5.0f);
+  EXPECT_EQ(madd(2, 3, 4), 10);
+
+  int total{0};
+
+  for (int i{0}; i < 8; ++i) {
+    if (0 == (i % 4)) refill();
+
+    total += dispatch(i);
+  }
+
+  EXPECT_EQ(refills, 2);
+  EXPECT_EQ(total, 36);
+}
+
+namespace {
+
+struct machine;
+
+using handler = int (*)(machine &, unsigned) noexcept;
+
+struct machine {
+  unsigned char const * code;
+  handler const * handlers;
+  int accumulator;
+};
+
+//	Each handler executes one opcode and tail calls the next.
+int
+op_halt(machine & io_machine, unsigned in_pc) noexcept {
+  static_cast<void>(in_pc);
+
+  return io_machine.accumulator;
+}
+
+int
+op_increment(machine & io_machine, unsigned in_pc) noexcept {
+  ++io_machine.accumulator;
+
+  LBAL_MUSTTAIL return io_machine.handlers[io_machine.code[in_pc + 1]](
+      io_machine, in_pc + 1);
+}
+
+int
+op_double(machine & io_machine, unsigned in_pc) noexcept {
+  io_machine.accumulator *= 2;
+
+  LBAL_MUSTTAIL return io_machine.handlers[io_machine.code[in_pc + 1]](
+      io_machine, in_pc + 1);
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, MustTail) {
+  static constexpr handler handlers[]{op_halt, op_increment, op_double};
+  static constexpr unsigned char code[]{1, 1, 2, 1, 2, 0};
+
+  machine state{code, handlers, 0};
+
+  EXPECT_EQ(handlers[code[0]](state, 0), 10);
+
+  static_assert(
+      LBAL_FEATURE_MUSTTAIL == 0 || LBAL_FEATURE_MUSTTAIL == 1,
+      "LBAL_FEATURE_MUSTTAIL must be a boolean");
+}
+
+namespace {
+
+struct stateless_allocator {};
+
+struct buffer {
+  LBAL_NO_UNIQUE_ADDRESS stateless_allocator allocator;
+  int * data;
+  std::size_t size;
+};
+
+class LBAL_CLASS_TRIVIAL_ABI unique_handle {
+ public:
+  explicit unique_handle(int * in_target) noexcept : target_{in_target} {}
+
+  unique_handle(unique_handle && io_other) noexcept
+      : target_{io_other.target_} {
+    io_other.target_ = nullptr;
+  }
+
+  unique_handle(unique_handle const &) = delete;
+  unique_handle & operator=(unique_handle const &) = delete;
+
+  ~unique_handle() {
+    if (target_) ++*target_;
+  }
+
+ private:
+  int * target_;
+};
+
+LBAL_FUNC_NOINLINE void
+consume(unique_handle in_handle) noexcept {
+  static_cast<void>(in_handle);
+}
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, LayoutDecorators) {
+  //	Where the attribute is honored, the empty member takes no space.
+#if LBAL_TARGET_COMPILER_GCC || LBAL_TARGET_COMPILER_CLANG
+  static_assert(sizeof(buffer) == sizeof(int *) + sizeof(std::size_t)
+          || (__cplusplus < 202002L),
+      "LBAL_NO_UNIQUE_ADDRESS failed to elide an empty member");
+#endif
+
+  int destroyed{0};
+
+  consume(unique_handle{&destroyed});
+  EXPECT_EQ(destroyed, 1);
+}
+
+//	Visibility only means something for symbols with external linkage.
+extern "C" LBAL_VIS_PROTECTED int
+lbal_protected_square(int in_value) noexcept;
+
+extern "C" LBAL_FUNC_NOINLINE int
+lbal_protected_square(int in_value) noexcept {
+  return in_value * in_value;
+}
+
+//	`noplt` only matters for functions from other shared objects, but it’s
+//	harmless on a local definition.
+extern "C" LBAL_FUNC_NOPLT int
+lbal_noplt_negate(int in_value) noexcept;
+
+extern "C" int
+lbal_noplt_negate(int in_value) noexcept {
+  return -in_value;
+}
+
+GTEST_TEST(lbalTest, LinkageDecorators) {
+  EXPECT_EQ(lbal_protected_square(7), 49);
+  EXPECT_EQ(lbal_noplt_negate(-3), 3);
+
+#if defined(__PIC__)
+  static_assert(LBAL_BUILD_PIC == 1, "LBAL_BUILD_PIC should follow __PIC__");
+#elif LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC
+  static_assert(LBAL_BUILD_PIC == 0, "LBAL_BUILD_PIC should follow __PIC__");
+#endif
+
+#if defined(__PIE__)
+  static_assert(LBAL_BUILD_PIE == 1, "LBAL_BUILD_PIE should follow __PIE__");
+#elif LBAL_TARGET_COMPILER_CLANG || LBAL_TARGET_COMPILER_GCC
+  static_assert(LBAL_BUILD_PIE == 0, "LBAL_BUILD_PIE should follow __PIE__");
+#endif
+
+  static_assert(LBAL_BUILD_PIE == 0 || LBAL_BUILD_PIC == 1,
+      "LBAL_BUILD_PIE implies LBAL_BUILD_PIC");
+  static_assert(LBAL_BUILD_NO_SEMANTIC_INTERPOSITION == 0
+          || LBAL_BUILD_NO_SEMANTIC_INTERPOSITION == 1,
+      "LBAL_BUILD_NO_SEMANTIC_INTERPOSITION must be a boolean");
+}
+
+namespace {
+
+LBAL_TLS_INITIAL_EXEC thread_local int trace_depth{0};
+LBAL_TLS_LOCAL_EXEC thread_local int local_counter{0};
+LBAL_TLS_LOCAL_DYNAMIC thread_local int cache_hits{0};
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, TLSModels) {
+  ++trace_depth;
+  local_counter += 2;
+  cache_hits += 3;
+
+  EXPECT_EQ(trace_depth + local_counter + cache_hits, 6);
+}
+
+namespace {
+
+LBAL_FUNC_HOT_TEXT int
+hot_increment(int in_value) noexcept {
+  return in_value + 1;
+}
+
+LBAL_FUNC_COLD_TEXT int
+cold_decrement(int in_value) noexcept {
+  return in_value - 1;
+}
+
+#if defined(__ELF__)
+LBAL_SECTION(".text.lbal_test") int
+placed_double(int in_value) noexcept {
+  return in_value * 2;
+}
+#else
+int
+placed_double(int in_value) noexcept {
+  return in_value * 2;
+}
+#endif
+
+}  //	namespace
+
+GTEST_TEST(lbalTest, CodePlacement) {
+  EXPECT_EQ(hot_increment(1), 2);
+  EXPECT_EQ(cold_decrement(1), 0);
+  EXPECT_EQ(placed_double(4), 8);
+}
@@ -40,12 +40,6 @@
   #define LBAL_DIAGNOSTIC_LOG_UNSUPPORTED(LBAL_DIAGNOSTIC_feature_)
 #endif
 
-#if LBAL_CPP17_IF_CONSTEXPR
-  #define LBAL_IF_CONSTEXPR if constexpr
-#else
-  #define LBAL_IF_CONSTEXPR if
-#endif
-
 #define LBAL_DIAGNOSTIC_TEST(LBAL_DIAGNOSTIC_feature_)                         \
   do {                                                                         \
     LBAL_IF_CONSTEXPR (0 == LBAL_DIAGNOSTIC_feature_) {                        \
@@ -690,5 +684,3 @@ GTEST_TEST(lbalTest, Validation) {
 
   EXPECT_TRUE(true);
 }
-
-#undef LBAL_IF_CONSTEXPR
@@ -0,0 +1,231 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalPlatformInfoTest”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+------------------------------------------------------------------------------*/
+
+//	lbal
+#include <lucenaBAL/lbalPlatformInfo.hpp>
+
+//  gtest
+#include <gtest/gtest.h>
+
+//	std
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace LBAL_;
+
+/*------------------------------------------------------------------------------
+ */
+
+GTEST_TEST(lbalTest, CacheInfo) {
+  static_assert(LBAL_TARGET_CACHE_LINE_SIZE > 0, "");
+  static_assert(
+      LBAL_TARGET_CACHE_INTERFERENCE_SIZE >= LBAL_TARGET_CACHE_LINE_SIZE, "");
+
+  auto const & caches = cache_info();
+
+  EXPECT_EQ(&caches, &cache_info());
+
+  EXPECT_GT(caches.line_size, 0u);
+  EXPECT_EQ(caches.line_size & (caches.line_size - 1), 0u);
+
+  if (caches.l1d.size && caches.l2.size) {
+    EXPECT_GE(caches.l2.size, caches.l1d.size);
+  }
+
+  if (caches.l2.size && caches.l3.size) {
+    EXPECT_GE(caches.l3.size, caches.l2.size);
+  }
+}
+
+GTEST_TEST(lbalTest, PageInfo) {
+  static_assert(LBAL_TARGET_PAGE_SIZE_DEFAULT >= 4096, "");
+  static_assert(
+      (LBAL_TARGET_PAGE_SIZE_DEFAULT & (LBAL_TARGET_PAGE_SIZE_DEFAULT - 1))
+          == 0,
+      "");
+
+  auto const size = page_size();
+
+  EXPECT_GE(size, 4096u);
+  EXPECT_EQ(size & (size - 1), 0u);
+
+  auto const & huge_sizes = huge_page_sizes();
+
+  for (std::size_t i{0}; i < huge_sizes.size(); ++i) {
+    EXPECT_GT(huge_sizes[i], size);
+    EXPECT_EQ(huge_sizes[i] & (huge_sizes[i] - 1), 0u);
+
+    if (i) {
+      EXPECT_GT(huge_sizes[i], huge_sizes[i - 1]);
+    }
+  }
+
+  auto const mode = transparent_huge_pages_mode();
+
+  //	The mode is sampled once, so later calls must agree with the first.
+  EXPECT_EQ(transparent_huge_pages_mode(), mode);
+
+  //	Only Linux reports THP at all, and even there it may be compiled out or
+  //	sysfs may be hidden, so `unsupported` remains a valid answer.
+#if !defined(__linux__)
+  EXPECT_EQ(mode, thp_mode::unsupported);
+#else
+  EXPECT_TRUE((thp_mode::always == mode) || (thp_mode::madvise == mode)
+      || (thp_mode::never == mode) || (thp_mode::unsupported == mode));
+#endif
+}
+
+GTEST_TEST(lbalTest, NUMATopology) {
+  auto const & topology = numa_topology();
+
+  ASSERT_GE(topology.node_count(), 1u);
+  EXPECT_EQ(&topology, &numa_topology());
+
+  std::size_t cpu_count{0};
+
+  for (std::size_t index{0}; index < topology.node_count(); ++index) {
+    auto const & node = topology.nodes[index];
+
+    if (index) {
+      EXPECT_GT(node.id, topology.nodes[index - 1].id);
+    }
+
+    for (auto const cpu : node.cpus) {
+      ASSERT_LT(cpu, topology.cpu_to_node.size());
+      EXPECT_EQ(topology.cpu_to_node[cpu], index);
+    }
+
+    cpu_count += node.cpus.size();
+
+    //	Local access is never more expensive than remote access.
+    for (std::size_t other{0}; other < topology.node_count(); ++other) {
+      if (topology.distance(index, other)) {
+        EXPECT_LE(topology.distance(index, index),
+            topology.distance(index, other));
+      }
+    }
+  }
+
+  EXPECT_LE(cpu_count, topology.cpu_to_node.size());
+  EXPECT_EQ(topology.distance(topology.node_count(), 0), 0u);
+}
+
+GTEST_TEST(lbalTest, CPUTopology) {
+  auto const & topology = cpu_topology();
+
+  ASSERT_FALSE(topology.cpus.empty());
+  ASSERT_GE(topology.physical_core_count(), 1u);
+  ASSERT_FALSE(topology.cache_groups.empty());
+  EXPECT_LE(topology.physical_core_count(), topology.cpus.size());
+
+  bool has_performance{false};
+  bool has_efficiency{false};
+
+  for (std::size_t index{0}; index < topology.cpus.size(); ++index) {
+    auto const & cpu = topology.cpus[index];
+
+    if (index) {
+      EXPECT_GT(cpu.id, topology.cpus[index - 1].id);
+    }
+
+    ASSERT_LT(cpu.core, topology.cores.size());
+    ASSERT_LT(cpu.cache_group, topology.cache_groups.size());
+
+    auto const & siblings = topology.cores[cpu.core];
+
+    EXPECT_NE(std::find(siblings.begin(), siblings.end(), cpu.id),
+        siblings.end());
+
+    EXPECT_NE(cpu.kind, core_kind::unknown);
+
+    has_performance = has_performance || (core_kind::performance == cpu.kind);
+    has_efficiency = has_efficiency || (core_kind::efficiency == cpu.kind);
+  }
+
+  EXPECT_TRUE(has_performance);
+  EXPECT_EQ(topology.hybrid, has_efficiency);
+}
+
+#if LBAL_TARGET_OS_X11
+GTEST_TEST(lbalTest, ReadFirstLine) {
+  //	A sparse cpu list like this easily outgrows any fixed-size buffer.
+  std::string list;
+
+  for (unsigned cpu{0}; cpu < 400; cpu += 2) {
+    if (!list.empty()) list += ',';
+
+    list += std::to_string(cpu);
+  }
+
+  ASSERT_GT(list.size(), 256u);
+
+  std::string const path{::testing::TempDir() + "lbal_read_first_line.txt"};
+
+  {
+    std::ofstream file{path};
+
+    file << list << "\r\nsecond line\n";
+  }
+
+  std::string line;
+
+  ASSERT_TRUE(details::read_first_line(path.c_str(), line));
+  EXPECT_EQ(line, list);
+  EXPECT_EQ(details::parse_cpu_list(line).size(), 200u);
+
+  std::remove(path.c_str());
+
+  EXPECT_FALSE(details::read_first_line(path.c_str(), line));
+}
+#endif
+
+#if LBAL_TARGET_OS_X11
+GTEST_TEST(lbalTest, SysfsParsing) {
+  using list = std::vector<unsigned>;
+
+  EXPECT_EQ(details::parse_cpu_list("0-3,8-11"),
+      (list{0, 1, 2, 3, 8, 9, 10, 11}));
+  EXPECT_EQ(details::parse_cpu_list("5"), list{5});
+  EXPECT_EQ(details::parse_cpu_list("0,2,4-5"), (list{0, 2, 4, 5}));
+  EXPECT_EQ(details::parse_cpu_list("7-7"), list{7});
+  EXPECT_EQ(details::parse_cpu_list("0-1 "), (list{0, 1}));
+  EXPECT_TRUE(details::parse_cpu_list("").empty());
+  EXPECT_TRUE(details::parse_cpu_list("  ").empty());
+
+  //	Malformed lists are rejected outright, not partially parsed.
+  EXPECT_TRUE(details::parse_cpu_list("0-3,x").empty());
+  EXPECT_TRUE(details::parse_cpu_list("3-1").empty());
+  EXPECT_TRUE(details::parse_cpu_list("0-").empty());
+  EXPECT_TRUE(details::parse_cpu_list("0,,1").empty());
+  EXPECT_TRUE(details::parse_cpu_list("0-3,").empty());
+  EXPECT_TRUE(details::parse_cpu_list("99999999999").empty());
+  EXPECT_EQ(details::count_cpu_list("0-3,8,10-11"), 7u);
+
+  EXPECT_EQ(details::parse_size("48K"), 48u * 1024);
+  EXPECT_EQ(details::parse_size("2048 kB"), 2048u * 1024);
+  EXPECT_EQ(details::parse_size("1M"), 1024u * 1024);
+  EXPECT_EQ(details::parse_size("1G"), 1024u * 1024 * 1024);
+  EXPECT_EQ(details::parse_size("64"), 64u);
+  EXPECT_EQ(details::parse_size(""), 0u);
+  EXPECT_EQ(details::parse_size("K"), 0u);
+
+  EXPECT_EQ(details::parse_distance_row("10 21 31 21"),
+      (list{10, 21, 31, 21}));
+  EXPECT_EQ(details::parse_distance_row("10"), list{10});
+  EXPECT_EQ(details::parse_distance_row(" 10  20 "), (list{10, 20}));
+  EXPECT_TRUE(details::parse_distance_row("").empty());
+  EXPECT_TRUE(details::parse_distance_row("10 2x 30").empty());
+}
+#endif
@@ -0,0 +1,57 @@
+/*------------------------------------------------------------------------------
+
+  Lucena Build Abstraction Library
+  “lbalSelectCodegen”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+  This is never linked; `lbalCodegenTest.cmake` compiles it to assembly and
+  fails if any conditional branch appears. Every function must therefore be
+  straight-line code, with no loops.
+
+------------------------------------------------------------------------------*/
+
+//	lbal
+#include <lucenaBAL/lbalBuiltins.hpp>
+
+//	std
+#include <cstdint>
+
+/*------------------------------------------------------------------------------
+ */
+
+extern "C" int
+lbal_select_int(int in_lhs, int in_rhs) noexcept {
+  return LBAL_::select(in_lhs < in_rhs, in_lhs, in_rhs);
+}
+
+extern "C" std::uint64_t
+lbal_select_u64(std::uint64_t in_hash, std::uint64_t in_lhs,
+    std::uint64_t in_rhs) noexcept {
+  return LBAL_::select(0 != (in_hash & 1), in_lhs, in_rhs);
+}
+
+extern "C" double
+lbal_select_double(double in_lhs, double in_rhs) noexcept {
+  return LBAL_::select(in_lhs < in_rhs, in_lhs, in_rhs);
+}
+
+extern "C" int const *
+lbal_select_pointer(
+    int const * in_lhs, int const * in_rhs, unsigned in_key) noexcept {
+  return LBAL_::select(0 != (in_key & 0x10), in_lhs, in_rhs);
+}
+
+//	One compare-exchange of a sorting network.
+extern "C" void
+lbal_select_compare_exchange(int * io_lhs, int * io_rhs) noexcept {
+  int const lhs{*io_lhs};
+  int const rhs{*io_rhs};
+  bool const ordered{lhs < rhs};
+
+  *io_lhs = LBAL_::select(ordered, lhs, rhs);
+  *io_rhs = LBAL_::select(ordered, rhs, lhs);
+}
@@ -0,0 +1,220 @@
+#[[#############################################################################
+
+  Lucena Build Abstraction Library
+  “lbalSymbolOrdering.cmake”
+  Copyright © 2026 Lucena
+  All Rights Reserved
+
+  This file is distributed under the University of Illinois Open Source
+  License. See LICENSE.md for details.
+
+	Provides `lbal_target_symbol_ordering`, which turns a function profile
+	into a linker symbol-ordering file, so that the hottest functions are laid
+	out contiguously:
+
+		lbal_target_symbol_ordering (<target>
+			PROFILE <file>
+			[OUTPUT <file>]
+			[LIMIT <count>])
+
+	`PROFILE` is a text file with one `<weight> <symbol>` pair per line, e.g.,
+	as produced by `perf report --no-children --sort symbol -F overhead,sym`
+	with the `%` and `[.]` columns stripped; weights may be integers or
+	decimals, and blank lines and lines starting with `#` are ignored. Symbols
+	must be spelled as the linker sees them, i.e., mangled. The heaviest
+	`LIMIT` symbols, or all of them, are written to `OUTPUT`, which defaults to
+	`<target>.order` in the current binary directory, and the file is passed to
+	the linker.
+
+	This requires `CMAKE_CXX_COMPILER_LINKER_ID`, and supports ld.lld and mold
+	for ELF, ld64 and ld64.lld for Mach-O, and link.exe and lld-link for COFF.
+	GNU ld and gold can only order whole sections; for those, use
+	`LBAL_FUNC_HOT_TEXT` instead.
+
+	Also provides `lbal_target_keep_text_prefixes`, which links an ELF target
+	with `-z keep-text-section-prefix` under LLD or mold, so that functions
+	marked `LBAL_FUNC_HOT_TEXT` or `LBAL_FUNC_COLD_TEXT` stay grouped in
+	their own output sections, as GNU ld already does by default:
+
+		lbal_target_keep_text_prefixes (<target>)
+
+##############################################################################]]
+
+include_guard (GLOBAL)
+
+
+#[[#############################################################################
+  helpers
+#]]
+
+# Convert a decimal weight into a fixed-width key that sorts correctly as a
+# string, since CMake has no floating-point comparisons.
+function (_lbal_ordering_sort_key in_weight o_key)
+	string (REGEX MATCH "^([0-9]*)(\\.([0-9]*))?$" matched "${in_weight}")
+
+	if (NOT matched)
+		set (${o_key} "" PARENT_SCOPE)
+		return()
+	endif()
+
+	set (whole "${CMAKE_MATCH_1}")
+	set (fraction "${CMAKE_MATCH_3}")
+
+	string (LENGTH "${whole}" whole_length)
+	math (EXPR padding "20 - ${whole_length}")
+
+	if (padding GREATER 0)
+		string (REPEAT "0" ${padding} zeroes)
+		string (PREPEND whole "${zeroes}")
+	endif()
+
+	string (SUBSTRING "${fraction}000000000000" 0 12 fraction)
+
+	set (${o_key} "${whole}.${fraction}" PARENT_SCOPE)
+endfunction()
+
+# Report the object file format of the target platform as `ELF`, `MACHO`, or
+# `COFF`; the linker ID alone is ambiguous, since LLD comes in all three.
+function (_lbal_ordering_object_format o_format)
+	if (APPLE)
+		set (${o_format} "MACHO" PARENT_SCOPE)
+	elseif (WIN32)
+		set (${o_format} "COFF" PARENT_SCOPE)
+	else()
+		set (${o_format} "ELF" PARENT_SCOPE)
+	endif()
+endfunction()
+
+
+#[[#############################################################################
+  interface
+#]]
+
+function (lbal_target_symbol_ordering in_target)
+	cmake_parse_arguments (PARSE_ARGV 1 arg "" "PROFILE;OUTPUT;LIMIT" "")
+
+	if (NOT TARGET ${in_target})
+		message (FATAL_ERROR
+			"lbal_target_symbol_ordering: ${in_target} is not a target")
+	endif()
+
+	if (NOT arg_PROFILE OR NOT EXISTS "${arg_PROFILE}")
+		message (FATAL_ERROR
+			"lbal_target_symbol_ordering: PROFILE “${arg_PROFILE}” not found")
+	endif()
+
+	if (NOT arg_OUTPUT)
+		set (arg_OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/${in_target}.order")
+	endif()
+
+	# Re-run configuration whenever the profile changes.
+	set_property (
+		DIRECTORY
+		APPEND
+		PROPERTY
+			CMAKE_CONFIGURE_DEPENDS "${arg_PROFILE}")
+
+	file (STRINGS "${arg_PROFILE}" lines)
+
+	set (entries "")
+
+	foreach (line IN LISTS lines)
+		string (STRIP "${line}" line)
+
+		if (line STREQUAL "" OR line MATCHES "^#")
+			continue()
+		endif()
+
+		if (NOT line MATCHES "^([0-9.]+)[ \t]+([^ \t]+)$")
+			message (WARNING
+				"lbal_target_symbol_ordering: ignoring malformed line “${line}”")
+			continue()
+		endif()
+
+		set (symbol "${CMAKE_MATCH_2}")
+		_lbal_ordering_sort_key ("${CMAKE_MATCH_1}" key)
+
+		if (key STREQUAL "")
+			message (WARNING
+				"lbal_target_symbol_ordering: ignoring malformed line “${line}”")
+			continue()
+		endif()
+
+		list (APPEND entries "${key} ${symbol}")
+	endforeach()
+
+	# A symbol listed more than once keeps its heaviest weight, and only
+	# distinct symbols count toward `LIMIT`.
+	list (SORT entries ORDER DESCENDING)
+	list (TRANSFORM entries REPLACE "^[^ ]+ " "")
+	list (REMOVE_DUPLICATES entries)
+
+	if (arg_LIMIT)
+		list (SUBLIST entries 0 ${arg_LIMIT} entries)
+	endif()
+
+	list (JOIN entries "\n" contents)
+
+	# Only touch the file when it changes, to avoid needless relinking.
+	set (existing "")
+
+	if (EXISTS "${arg_OUTPUT}")
+		file (READ "${arg_OUTPUT}" existing)
+	endif()
+
+	if (NOT existing STREQUAL "${contents}\n")
+		file (WRITE "${arg_OUTPUT}" "${contents}\n")
+	endif()
+
+	# Each function needs its own section for the linker to move it.
+	if (MSVC)
+		target_compile_options (${in_target} PRIVATE /Gy)
+	elseif (CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" AND NOT APPLE)
+		target_compile_options (${in_target} PRIVATE -ffunction-sections)
+	endif()
+
+	_lbal_ordering_object_format (format)
+
+	if (format STREQUAL "ELF"
+			AND CMAKE_CXX_COMPILER_LINKER_ID MATCHES "^(LLD|MOLD)$")
+		target_link_options (${in_target}
+			PRIVATE "LINKER:--symbol-ordering-file=${arg_OUTPUT}")
+	elseif (format STREQUAL "MACHO"
+			AND CMAKE_CXX_COMPILER_LINKER_ID MATCHES "^(AppleClang|LLD)$")
+		target_link_options (${in_target}
+			PRIVATE "LINKER:-order_file,${arg_OUTPUT}")
+	elseif (format STREQUAL "COFF"
+			AND CMAKE_CXX_COMPILER_LINKER_ID MATCHES "^(MSVC|LLD)$"
+			AND CMAKE_CXX_COMPILER_FRONTEND_VARIANT STREQUAL "MSVC")
+		target_link_options (${in_target} PRIVATE "/ORDER:@${arg_OUTPUT}")
+	else()
+		message (WARNING
+			"lbal_target_symbol_ordering: ${format} linker "
+			"“${CMAKE_CXX_COMPILER_LINKER_ID}” can’t order symbols; "
+			"${arg_OUTPUT} was written but not used")
+		return()
+	endif()
+
+	set_property (
+		TARGET ${in_target}
+		APPEND
+		PROPERTY
+			LINK_DEPENDS "${arg_OUTPUT}")
+endfunction()
+
+function (lbal_target_keep_text_prefixes in_target)
+	if (NOT TARGET ${in_target})
+		message (FATAL_ERROR
+			"lbal_target_keep_text_prefixes: ${in_target} is not a target")
+	endif()
+
+	_lbal_ordering_object_format (format)
+
+	# GNU ld already keeps these sections grouped, and the other formats have
+	# no equivalent.
+	if (format STREQUAL "ELF"
+			AND CMAKE_CXX_COMPILER_LINKER_ID MATCHES "^(LLD|MOLD)$")
+		target_link_options (${in_target}
+			PRIVATE "LINKER:-z,keep-text-section-prefix")
+	endif()
+endfunction()